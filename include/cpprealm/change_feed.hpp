@@ -0,0 +1,213 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef CPPREALM_CHANGE_FEED_HPP
+#define CPPREALM_CHANGE_FEED_HPP
+
+#include <cpprealm/db.hpp>
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace realm {
+
+    /**
+     The objects of one type which changed in a committed version, identified by their object keys.
+     */
+    struct change_event {
+        // The version the changes were committed in.
+        uint64_t version = 0;
+        std::string object_type;
+        // Set when the feed could not resume from the given cursor. `insertions` then holds
+        // every object of the type and the consumer should rebuild its copy from them.
+        bool is_resync = false;
+        std::vector<int64_t> insertions;
+        std::vector<int64_t> modifications;
+        std::vector<int64_t> deletions;
+        // The properties which were modified, when the change records them.
+        std::vector<std::string> modified_properties;
+    };
+
+    /**
+     The position of a consumer in a `change_feed`. Persist it after processing events and pass
+     it to the feed when it is restarted.
+     */
+    struct change_feed_cursor {
+        // The version up to which every change was delivered.
+        uint64_t version = 0;
+        // Identifies the contents of the watched tables at `version`.
+        uint64_t tables_state = 0;
+    };
+
+    /**
+     Reports the objects of the types `Ts...` which were inserted, modified or deleted by each
+     commit, e.g. to replicate them incrementally into another store.
+
+     Events are delivered on the thread of `realm` whenever it advances to a newer version,
+     one event per type which changed. If the Realm falls behind by several commits, their
+     changes are reported together under the latest version.
+
+     The feed resumes from `cursor`, the value of `cursor()` the consumer saved last. If the
+     watched tables were written to after it, the changes are not retained by the Realm, so
+     the first event for each type is a resync. Commits which only changed other tables don't
+     require a resync. Without a cursor the feed starts at the current version.
+     */
+    template <typename ...Ts>
+    struct change_feed {
+        change_feed(db& realm, std::optional<change_feed_cursor> cursor, std::function<void(const change_event&)>&& handler)
+            : m_state(std::make_shared<state>()), m_realm(realm.m_realm) {
+            m_state->handler = std::move(handler);
+            m_state->pending_initial = sizeof...(Ts);
+            auto version = m_realm.read_transaction_version();
+            auto tables_state = get_tables_state();
+            bool resync = cursor && cursor->version != version && cursor->tables_state != tables_state;
+            m_start = resync ? *cursor : change_feed_cursor{version, tables_state};
+            (observe<Ts>(version, resync), ...);
+        }
+        change_feed(const change_feed&) = delete;
+        change_feed& operator=(const change_feed&) = delete;
+        change_feed(change_feed&&) = default;
+        change_feed& operator=(change_feed&&) = default;
+        ~change_feed() = default;
+
+        /**
+         The position to save once the delivered events have been processed. It advances with
+         every commit the Realm has caught up with, including commits which didn't change the
+         watched types and so produced no event.
+         */
+        change_feed_cursor cursor() {
+            if (m_state->pending_initial > 0) {
+                return m_start;
+            }
+            return {m_realm.read_transaction_version(), get_tables_state()};
+        }
+
+    private:
+        struct state {
+            std::function<void(const change_event&)> handler;
+            // The number of types whose first notification hasn't been delivered yet.
+            size_t pending_initial = 0;
+        };
+
+        template <typename T>
+        struct table_observer : internal::bridge::collection_change_callback {
+            table_observer(std::shared_ptr<state> state,
+                           std::shared_ptr<internal::bridge::results> results,
+                           uint64_t start_version, bool resync)
+                : m_state(std::move(state)), m_results(std::move(results)),
+                  m_start_version(start_version), m_resync(resync) {
+                auto table = m_results->get_table();
+                for (size_t i = 0; i < std::tuple_size<decltype(managed<T>::schema.properties)>{}; i++) {
+                    m_property_for_column[table.get_column_key(managed<T>::schema.names[i]).value()] = managed<T>::schema.names[i];
+                }
+            }
+
+            void before(const internal::bridge::collection_change_set&) override {}
+
+            void after(const internal::bridge::collection_change_set& changes) override {
+                change_event event;
+                event.version = m_results->get_realm().read_transaction_version();
+                event.object_type = managed<T>::schema.name;
+                if (!m_initialized) {
+                    // Object keys of the results in order, so that the indices of
+                    // deleted and modified objects can be mapped back to keys.
+                    m_keys = m_results->get_keys();
+                    m_initialized = true;
+                    m_state->pending_initial--;
+                    // The first notification doesn't describe commits made after the
+                    // feed was created, so those also require a resync.
+                    if (!m_resync && event.version == m_start_version) {
+                        return;
+                    }
+                    event.is_resync = true;
+                    for (auto& key : m_keys) {
+                        event.insertions.push_back(key.value());
+                    }
+                    m_state->handler(event);
+                    return;
+                }
+                if (changes.empty()) {
+                    return;
+                }
+
+                for (auto i : changes.modifications().as_indexes()) {
+                    event.modifications.push_back(m_keys[i].value());
+                }
+                std::vector<size_t> deleted;
+                for (auto i : changes.deletions().as_indexes()) {
+                    event.deletions.push_back(m_keys[i].value());
+                    deleted.push_back(i);
+                }
+                for (auto it = deleted.rbegin(); it != deleted.rend(); ++it) {
+                    m_keys.erase(m_keys.begin() + static_cast<std::ptrdiff_t>(*it));
+                }
+                for (auto i : changes.insertions().as_indexes()) {
+                    auto key = internal::bridge::get<internal::bridge::obj>(*m_results, i).get_key();
+                    event.insertions.push_back(key.value());
+                    m_keys.insert(m_keys.begin() + static_cast<std::ptrdiff_t>(i), key);
+                }
+                for (auto column : changes.column_keys()) {
+                    if (auto it = m_property_for_column.find(column); it != m_property_for_column.end()) {
+                        event.modified_properties.push_back(it->second);
+                    }
+                }
+                if (event.insertions.empty() && event.modifications.empty() && event.deletions.empty()) {
+                    return;
+                }
+                m_state->handler(event);
+            }
+
+        private:
+            std::shared_ptr<state> m_state;
+            std::shared_ptr<internal::bridge::results> m_results;
+            std::vector<internal::bridge::obj_key> m_keys;
+            std::unordered_map<int64_t, std::string> m_property_for_column;
+            uint64_t m_start_version;
+            bool m_resync;
+            bool m_initialized = false;
+        };
+
+        template <typename T>
+        void observe(uint64_t start_version, bool resync) {
+            auto results = std::make_shared<internal::bridge::results>(
+                    m_realm, m_realm.table_for_object_type(managed<T>::schema.name));
+            notification_token token = results->add_notification_callback(
+                    std::make_shared<table_observer<T>>(m_state, results, start_version, resync));
+            token.m_realm = m_realm;
+            token.m_results = results;
+            m_tokens.push_back(std::move(token));
+        }
+
+        uint64_t get_tables_state() {
+            uint64_t tables_state = 14695981039346656037ULL;
+            ((tables_state = (tables_state ^ m_realm.table_for_object_type(managed<Ts>::schema.name).storage_ref()) * 1099511628211ULL), ...);
+            return tables_state;
+        }
+
+        std::shared_ptr<state> m_state;
+        internal::bridge::realm m_realm;
+        change_feed_cursor m_start;
+        std::vector<notification_token> m_tokens;
+    };
+}
+
+#endif //CPPREALM_CHANGE_FEED_HPP
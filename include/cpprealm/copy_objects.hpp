@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef CPPREALM_COPY_OBJECTS_HPP
+#define CPPREALM_COPY_OBJECTS_HPP
+
+#include <cpprealm/db.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace realm {
+
+    /**
+     Options for `copy_objects`.
+     */
+    struct copy_options {
+        // The number of objects copied per write transaction.
+        size_t batch_size = 1000;
+        // Delete each batch from the source once it has been committed to the target.
+        bool remove_from_source = false;
+    };
+
+    /**
+     The work done by `copy_objects`.
+     */
+    struct copy_stats {
+        size_t copied_objects = 0;
+        size_t removed_objects = 0;
+        // Linked objects which didn't exist in the target and were created with only their primary
+        // key. Copy their type as well to fill them in.
+        size_t stub_objects = 0;
+        // The number of write transactions committed to the target.
+        size_t batches = 0;
+        std::chrono::microseconds duration{0};
+
+        [[nodiscard]] double objects_per_second() const {
+            if (duration.count() == 0) {
+                return 0;
+            }
+            return static_cast<double>(copied_objects) * 1e6 / static_cast<double>(duration.count());
+        }
+    };
+
+    /**
+     Copies the objects in `source` into `target`, another Realm file whose schema contains `T`,
+     e.g. to move old objects from a frequently written Realm into an archive.
+
+     Objects are copied in write transactions of at most `options.batch_size` objects. An object
+     replaces the object with the same primary key in `target`, so copying a batch again after an
+     interruption doesn't create duplicates. Embedded objects are copied with their parent. Links
+     point to the object with the same primary key in `target`, which is created with only its
+     primary key if it doesn't exist yet and counted in `copy_stats::stub_objects`; copy the linked
+     types as well to keep the whole graph.
+
+     With `options.remove_from_source` each batch is deleted from the source Realm after it has
+     been committed to `target`. Both Realms must be opened on the calling thread and must not be
+     in a write transaction.
+     */
+    template <typename T>
+    copy_stats copy_objects(results<T>& source, db& target, const copy_options& options = {}) {
+        if (options.batch_size == 0) {
+            throw std::invalid_argument("The batch size of copy_objects must not be zero.");
+        }
+        auto start = std::chrono::steady_clock::now();
+        copy_stats stats;
+        // The snapshot keeps the indices stable while objects are removed from the source.
+        auto objects = source.snapshot();
+        size_t count = objects.size();
+        std::vector<internal::bridge::obj_key> batch_keys;
+        for (size_t begin = 0; begin < count; begin += options.batch_size) {
+            size_t end = std::min(begin + options.batch_size, count);
+            batch_keys.clear();
+            std::optional<internal::bridge::realm> source_realm;
+            target.write([&] {
+                auto target_table = target.m_realm.table_for_object_type(managed<T>::schema.name);
+                for (size_t i = begin; i < end; i++) {
+                    auto object = objects[i];
+                    target_table.copy_object(object.m_obj, &stats.stub_objects);
+                    batch_keys.push_back(object.m_obj.get_key());
+                    if (!source_realm) {
+                        source_realm = object.m_realm;
+                    }
+                }
+            });
+            stats.copied_objects += end - begin;
+            stats.batches++;
+
+            if (options.remove_from_source && source_realm) {
+                write_transaction transaction(*source_realm);
+                auto source_table = source_realm->table_for_object_type(managed<T>::schema.name);
+                size_t removed = 0;
+                for (auto& key : batch_keys) {
+                    if (source_table.is_valid(key)) {
+                        source_table.remove_object(key);
+                        removed++;
+                    }
+                }
+                transaction.commit();
+                stats.removed_objects += removed;
+            }
+        }
+        stats.duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        return stats;
+    }
+}
+
+#endif //CPPREALM_COPY_OBJECTS_HPP
@@ -30,10 +30,16 @@
 #include <cpprealm/internal/bridge/thread_safe_reference.hpp>
 #include <cpprealm/internal/bridge/sync_session.hpp>
 
+#include <array>
 #include <filesystem>
+#include <iterator>
+#include <map>
 #include <optional>
+#include <set>
+#include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace realm {
     namespace {
@@ -60,6 +66,91 @@ namespace realm {
 
 namespace realm {
 
+    enum class update_policy {
+        // Overwrite every property of an existing object with the same primary key.
+        all,
+        // Only write the properties whose value differs from the existing object.
+        modified,
+    };
+
+    struct db;
+    struct read_view;
+
+    /**
+     A write transaction which is cancelled when it goes out of scope without having been
+     committed, e.g. because an exception was thrown while writing.
+     */
+    struct write_transaction {
+        explicit write_transaction(const db& realm);
+        explicit write_transaction(const internal::bridge::realm& realm);
+        write_transaction(const write_transaction&) = delete;
+        write_transaction& operator=(const write_transaction&) = delete;
+        ~write_transaction();
+
+        void commit();
+        void cancel();
+
+    private:
+        internal::bridge::realm m_realm;
+        bool m_active = true;
+    };
+
+    /**
+     Options for `db::write_copy`.
+     */
+    struct write_copy_options {
+        // Encrypt the copy with this key. Without a key the copy is not encrypted, even if the Realm is.
+        std::optional<std::array<char, 64>> encryption_key;
+        // Skip the copy if nothing was committed after this version, e.g. the version
+        // returned by the previous backup.
+        std::optional<uint64_t> unchanged_since;
+    };
+
+    using frozen_realm_stats = internal::bridge::frozen_realm_stats;
+    using db_file_stats = internal::bridge::file_stats;
+
+    /**
+     When `db::compact_if_needed` compacts the file.
+     */
+    struct compaction_policy {
+        // Compact once at least this share of the file is free space.
+        double min_free_ratio = 0.5;
+        // Leave files smaller than this alone, compacting them gains little.
+        uint64_t min_file_size = 0;
+    };
+
+    /**
+     Returns the frozen versions currently shared through `freeze()`. Freezing a Realm, results
+     or an object at a version which is already frozen reuses that frozen Realm instead of
+     opening another one, so each entry is one pinned version no matter how many threads use it.
+     */
+    inline frozen_realm_stats get_frozen_realm_stats() {
+        return internal::bridge::get_frozen_realm_stats();
+    }
+
+    /**
+     Stops commits from waiting for their changes to be synced to disk, for every Realm file opened
+     by this process. Commits are much faster, but a power loss or OS crash can lose or corrupt recent
+     changes, so this is only for data which can be recreated, e.g. test fixtures or caches. Realms
+     which don't need a file at all should use `db_config::set_in_memory` instead.
+     */
+    inline void disable_sync_to_disk(bool disable = true) {
+        internal::bridge::disable_sync_to_disk(disable);
+    }
+
+    using frozen_version = internal::bridge::frozen_version;
+
+    /**
+     Returns every version held by a frozen Realm, with the time since it was frozen and the
+     number of handles sharing that frozen Realm. Only frozen Realms are listed: versions pinned
+     by thread safe references, live results or notification tokens are not. Held versions keep
+     the data they reference in the file, so old entries usually point at a frozen value which is
+     kept for too long. `db_config::set_max_number_of_active_versions` turns this growth into an error.
+     */
+    inline std::vector<frozen_version> get_frozen_versions() {
+        return internal::bridge::get_frozen_versions();
+    }
+
     struct db {
         static inline std::vector<internal::bridge::object_schema> schemas;
         internal::bridge::realm m_realm;
@@ -72,19 +163,51 @@ namespace realm {
 
         void begin_write() const { m_realm.begin_transaction(); }
         void commit_write() const { m_realm.commit_transaction(); }
+        /// Discards the changes of the current write transaction.
+        void cancel_write() const { m_realm.cancel_transaction(); }
+        [[nodiscard]] bool is_in_write() const { return m_realm.is_in_transaction(); }
 
+        /**
+         Calls `fn` inside a write transaction and commits it. If `fn` throws, the transaction
+         is cancelled before the exception propagates.
+         */
         template <typename Fn>
         std::invoke_result_t<Fn> write(Fn&& fn) const {
-            begin_write();
+            write_transaction transaction(*this);
             if constexpr (!std::is_void_v<std::invoke_result_t<Fn>>) {
                 auto val = fn();
-                commit_write();
+                transaction.commit();
                 return val;
             } else {
                 fn();
-                commit_write();
+                transaction.commit();
             }
         }
+
+        /**
+         Calls `fn(element)` for every element of `range`, committing after every `max_per_commit`
+         elements so that long imports don't hold the write lock or grow one transaction without bound.
+         If `fn` throws, the current chunk is cancelled and the exception rethrown; chunks which were
+         already committed are kept. Returns the number of commits.
+         */
+        template <typename Range, typename Fn>
+        size_t write_chunked(Range&& range, Fn&& fn, size_t max_per_commit = 1000) const {
+            if (max_per_commit == 0) {
+                throw std::invalid_argument("write_chunked needs to commit at least one element at a time.");
+            }
+            size_t commits = 0;
+            auto it = std::begin(range);
+            auto end = std::end(range);
+            while (it != end) {
+                write_transaction transaction(*this);
+                for (size_t i = 0; i < max_per_commit && it != end; ++i, ++it) {
+                    fn(*it);
+                }
+                transaction.commit();
+                ++commits;
+            }
+            return commits;
+        }
         template <typename U>
         managed<std::remove_const_t<U>> add(U &&v) {
             using T = std::remove_const_t<U>;
@@ -105,6 +228,31 @@ namespace realm {
             }, managed<T>::schema.ps);
             return managed<T>(std::move(m_obj), m_realm);
         }
+        /**
+         Adds `v`, or updates the existing object with the same primary key according to `policy`.
+         With `update_policy::modified` each property is compared with the stored value and only
+         properties which differ are written, so unchanged objects produce no changes or notifications.
+         Linked and embedded objects are compared by value. A collection which differs is replaced
+         as a whole, and a link which is now null is cleared.
+         */
+        template <typename U>
+        managed<std::remove_const_t<U>> add(U &&v, update_policy policy) {
+            using T = std::remove_const_t<U>;
+            if constexpr (managed<T>::schema.HasPrimaryKeyProperty) {
+                if (policy == update_policy::modified) {
+                    auto table = m_realm.table_for_object_type(managed<T>::schema.name);
+                    auto pk = v.*(managed<T>::schema.primary_key().ptr);
+                    if (auto obj_key = table.find_primary_key(realm::internal::bridge::mixed(serialize(pk.value)))) {
+                        auto existing = managed<T>(table.get_object(*obj_key), m_realm);
+                        std::apply([&existing, &v, this](auto && ...p) {
+                            (set_if_modified(existing, v, p), ...);
+                        }, managed<T>::schema.ps);
+                        return existing;
+                    }
+                }
+            }
+            return add(std::forward<U>(v));
+        }
         template <typename T>
         void remove(T& object)
         {
@@ -153,6 +301,50 @@ namespace realm {
             return results<T>(internal::bridge::results(m_realm, m_realm.table_for_object_type(managed<T>::schema.name)));
         }
 
+        template <typename T>
+        using primary_key_t = typename std::decay_t<decltype(managed<T>::schema)>::PrimaryKeyProperty::Result;
+
+        /**
+         Returns the object of type `T` with the given primary key, or `std::nullopt` if it does not exist.
+         The lookup uses the primary key index and does not build a query or results.
+         */
+        template <typename T>
+        std::optional<managed<T>> find(const primary_key_t<T>& primary_key)
+        {
+            auto table = m_realm.table_for_object_type(managed<T>::schema.name);
+            return find<T>(table, primary_key);
+        }
+
+        /**
+         Looks up an object for each primary key in `primary_keys`, in the same order.
+         Keys without a matching object yield `std::nullopt`.
+         */
+        template <typename T, typename Range>
+        std::vector<std::optional<managed<T>>> find_many(const Range& primary_keys)
+        {
+            auto table = m_realm.table_for_object_type(managed<T>::schema.name);
+            std::vector<std::optional<managed<T>>> objects;
+            using iterator_category = typename std::iterator_traits<decltype(std::begin(primary_keys))>::iterator_category;
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, iterator_category>) {
+                objects.reserve(static_cast<size_t>(std::distance(std::begin(primary_keys), std::end(primary_keys))));
+            }
+            for (const auto& primary_key : primary_keys) {
+                objects.push_back(find<T>(table, primary_key_t<T>(primary_key)));
+            }
+            return objects;
+        }
+
+        /**
+         Calls `fn` with a view which stays on the version that is current when the scope begins.
+         Every query made through the view during the scope sees the same data, even if other
+         threads commit meanwhile. Unlike `freeze()` no additional Realm is opened, and the
+         Realm moves on to the latest version as usual once `fn` returns.
+
+         Writing to this `db` or calling `refresh()` inside the scope advances the version.
+         */
+        template <typename Fn>
+        std::invoke_result_t<Fn, read_view&> read(Fn&& fn);
+
         [[maybe_unused]] bool refresh()
         {
             return m_realm.refresh();
@@ -172,6 +364,62 @@ namespace realm {
             return managed<T>(std::move(m_obj), m_realm);
         }
 
+        template <typename T>
+        results<T> resolve(thread_safe_reference<results<T>>&& tsr)
+        {
+            return results<T>(internal::bridge::resolve<internal::bridge::results>(m_realm, std::move(tsr.m_tsr)));
+        }
+
+        template <typename T>
+        results<std::remove_pointer_t<T>> resolve(thread_safe_reference<std::vector<T>>&& tsr)
+        {
+            auto list = internal::bridge::resolve<internal::bridge::list>(m_realm, std::move(tsr.m_tsr));
+            return results<std::remove_pointer_t<T>>(list.as_results());
+        }
+
+        template <typename T>
+        results<std::remove_pointer_t<T>> resolve(thread_safe_reference<std::set<T>>&& tsr)
+        {
+            auto set = internal::bridge::resolve<internal::bridge::set>(m_realm, std::move(tsr.m_tsr));
+            return results<std::remove_pointer_t<T>>(set.as_results());
+        }
+
+        template <typename T>
+        std::map<std::string, T> resolve(thread_safe_reference<std::map<std::string, T>>&& tsr)
+        {
+            static_assert(!std::is_pointer_v<T>, "Maps of links can not be resolved, pass a thread_safe_reference to the owning object instead.");
+            auto dictionary = internal::bridge::resolve<internal::bridge::dictionary>(m_realm, std::move(tsr.m_tsr));
+            std::map<std::string, T> values;
+            for (size_t i = 0; i < dictionary.size(); i++) {
+                auto [key, value] = dictionary.get_pair(i);
+                values.emplace(std::move(key), deserialize<T>(value));
+            }
+            return values;
+        }
+
+        /**
+         Writes a compacted copy of the version this `db` reads to `path`, which must not exist yet.
+         The copy is made from a frozen version, so other threads can keep writing meanwhile.
+         Returns the version which was copied, or `std::nullopt` if the copy was skipped
+         because of `options.unchanged_since`.
+         */
+        std::optional<uint64_t> write_copy(const std::string& path, const write_copy_options& options = {});
+
+        /**
+         Rewrites the file without its free space. Compacting requires exclusive access, so
+         this returns false without compacting if the file is open anywhere else, e.g. in
+         another thread or process, or if this `db` is frozen or in a write transaction.
+         */
+        bool compact();
+        /**
+         Compacts the file if `policy` asks for it. Like `compact()` this does nothing while the
+         file is open anywhere else. Call this at quiet points of a long running process, e.g.
+         after deleting many objects. Returns true if the file was compacted.
+         */
+        bool compact_if_needed(const compaction_policy& policy = {});
+        /// The size of the file, how much of it is free and the number of objects of each type.
+        db_file_stats file_stats() const;
+
         bool is_frozen() const;
         db freeze();
         db thaw();
@@ -183,6 +431,118 @@ namespace realm {
         template<typename T>
         friend void internal::bridge::realm::config::set_client_reset_handler(const client_reset_mode_base<T>&);
     private:
+        template <typename T, typename P>
+        void set_if_modified(managed<T>& existing, const T& v, const P& property) {
+            using Result = typename P::Result;
+            if constexpr (!P::is_primary_key && !internal::type_info::is_backlink<Result>::value) {
+                if (!is_modified(existing, v, property)) {
+                    return;
+                }
+                auto& value = v.*(P::ptr);
+                auto col = existing.m_obj.get_table().get_column_key(property.name);
+                if constexpr (std::is_pointer_v<Result>) {
+                    if (!value) {
+                        existing.m_obj.set_null(col);
+                        return;
+                    }
+                } else if constexpr ((internal::type_info::is_vector<Result>::value && !std::is_same_v<Result, std::vector<uint8_t>>)
+                                     || internal::type_info::is_set<Result>::value
+                                     || internal::type_info::is_map<Result>::value) {
+                    // The accessors only add elements, so the stored collection is replaced as a whole.
+                    existing.m_obj.clear_collection(col);
+                }
+                accessor<Result>::set(existing.m_obj, col, m_realm, value);
+            }
+        }
+
+        // Whether `v` differs from the stored object, comparing linked and embedded objects by value.
+        template <typename T>
+        bool is_modified(const internal::bridge::obj& stored, const T& v) {
+            auto existing = managed<T>(stored, m_realm);
+            return std::apply([&existing, &v, this](auto && ...p) {
+                return (is_modified(existing, v, p) || ...);
+            }, managed<T>::schema.ps);
+        }
+
+        template <typename T, typename P>
+        bool is_modified(managed<T>& existing, const T& v, const P& property) {
+            using Result = typename P::Result;
+            auto& value = v.*(P::ptr);
+            if constexpr (internal::type_info::is_backlink<Result>::value) {
+                return false;
+            } else if constexpr (P::is_primary_key) {
+                auto ptr = managed<T>::template unmanaged_to_managed_pointer(P::ptr);
+                return !((existing.*ptr).detach().value == value.value);
+            } else if constexpr (internal::type_info::is_comparable_for_update<Result>::value) {
+                auto ptr = managed<T>::template unmanaged_to_managed_pointer(P::ptr);
+                return !((existing.*ptr).detach() == value);
+            } else {
+                auto col = existing.m_obj.get_table().get_column_key(property.name);
+                if constexpr (std::is_pointer_v<Result>) {
+                    if (!value || existing.m_obj.is_null(col)) {
+                        return value || !existing.m_obj.is_null(col);
+                    }
+                    return is_modified(existing.m_obj.get_linked_object(col), *value);
+                } else if constexpr (internal::type_info::is_vector<Result>::value) {
+                    // Null elements are never stored.
+                    auto list = internal::bridge::list(m_realm, existing.m_obj, col);
+                    size_t stored = 0;
+                    for (auto& link : value) {
+                        if (!link) {
+                            continue;
+                        }
+                        if (stored == list.size() || is_modified(internal::bridge::get<internal::bridge::obj>(list, stored), *link)) {
+                            return true;
+                        }
+                        stored++;
+                    }
+                    return stored != list.size();
+                } else if constexpr (internal::type_info::is_set<Result>::value) {
+                    auto set = internal::bridge::set(m_realm, existing.m_obj, col);
+                    size_t count = 0;
+                    for (auto& link : value) {
+                        if (!link) {
+                            continue;
+                        }
+                        count++;
+                        bool found = false;
+                        for (size_t i = 0; i < set.size() && !found; i++) {
+                            found = !is_modified(set.get_obj(i), *link);
+                        }
+                        if (!found) {
+                            return true;
+                        }
+                    }
+                    return count != set.size();
+                } else {
+                    auto dictionary = existing.m_obj.get_dictionary(col);
+                    if (dictionary.size() != value.size()) {
+                        return true;
+                    }
+                    for (auto& [key, link] : value) {
+                        auto stored = dictionary.try_get(key);
+                        if (!stored || stored->is_null() != !link) {
+                            return true;
+                        }
+                        if (link && is_modified(dictionary.get_object(key), *link)) {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+            }
+        }
+
+        template <typename T>
+        std::optional<managed<T>> find(const internal::bridge::table& table, const primary_key_t<T>& primary_key)
+        {
+            auto obj_key = table.find_primary_key(internal::bridge::mixed(serialize(primary_key.value)));
+            if (!obj_key) {
+                return std::nullopt;
+            }
+            return managed<T>(table.get_object(*obj_key), m_realm);
+        }
+
         db(internal::bridge::realm&& r)
         {
             m_realm = std::move(r);
@@ -196,6 +556,73 @@ namespace realm {
     bool operator==(const db&, const db&);
     bool operator!=(const db&, const db&);
 
+    /**
+     A read-only view of a `db` which is pinned to one version, see `db::read`.
+     */
+    struct read_view {
+        template <typename T>
+        results<T> objects() {
+            return m_db.objects<T>();
+        }
+
+        template <typename T>
+        std::optional<managed<T>> find(const db::primary_key_t<T>& primary_key) {
+            return m_db.find<T>(primary_key);
+        }
+
+        read_view(const read_view&) = delete;
+        read_view& operator=(const read_view&) = delete;
+    private:
+        explicit read_view(db& db) : m_db(db) {}
+        friend struct db;
+        db& m_db;
+    };
+
+    inline write_transaction::write_transaction(const db& realm) : write_transaction(realm.m_realm) {
+    }
+
+    inline write_transaction::write_transaction(const internal::bridge::realm& realm) : m_realm(realm) {
+        m_realm.begin_transaction();
+    }
+
+    inline write_transaction::~write_transaction() {
+        if (m_active && m_realm.is_in_transaction()) {
+            m_realm.cancel_transaction();
+        }
+    }
+
+    inline void write_transaction::commit() {
+        m_realm.commit_transaction();
+        m_active = false;
+    }
+
+    inline void write_transaction::cancel() {
+        m_realm.cancel_transaction();
+        m_active = false;
+    }
+
+    template <typename Fn>
+    std::invoke_result_t<Fn, read_view&> db::read(Fn&& fn) {
+        // Starting the read transaction up front pins the version even if `fn`
+        // begins with something other than a query.
+        m_realm.read_group();
+        // Turning auto refresh off keeps the scheduler from advancing the Realm,
+        // restoring it afterwards lets it catch up with any pending commits.
+        struct auto_refresh_guard {
+            explicit auto_refresh_guard(internal::bridge::realm& realm)
+                : m_realm(realm), m_auto_refresh(realm.auto_refresh()) {
+                m_realm.set_auto_refresh(false);
+            }
+            ~auto_refresh_guard() {
+                m_realm.set_auto_refresh(m_auto_refresh);
+            }
+            internal::bridge::realm& m_realm;
+            bool m_auto_refresh;
+        } guard(m_realm);
+        read_view view(*this);
+        return fn(view);
+    }
+
     template <typename ...Ts>
     inline db open(const db_config& config) {
         auto config_copy = config;
@@ -0,0 +1,81 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef CPPREALM_DB_POOL_HPP
+#define CPPREALM_DB_POOL_HPP
+
+#include <cpprealm/db.hpp>
+
+#include <atomic>
+#include <chrono>
+
+namespace realm {
+
+    /**
+     Counters describing how often a `db_pool` could hand out an open `db`.
+     */
+    struct db_pool_stats {
+        // Checkouts which reused an open db.
+        uint64_t hits = 0;
+        // Checkouts which had to open a db.
+        uint64_t misses = 0;
+        // Open dbs which were released after being idle.
+        uint64_t evictions = 0;
+    };
+
+    /**
+     Keeps one open `db` per file and thread, for threads which run many short tasks that
+     each need a Realm, e.g. the workers of a thread pool.
+
+     `get` returns the calling thread's `db` for the config, refreshed to the latest version.
+     The first call on a thread opens it with a scheduler for that thread. Configs for the
+     same path share an instance if they have the same schema and encryption key, see
+     `db_config::opens_same_realm`. Instances which have not been checked out for
+     `idle_timeout` are released the next time the same thread calls `get` or `evict_idle`;
+     a `db` returned earlier stays usable.
+
+     Instances belong to the thread which opened them. Destroying the pool releases those of
+     the destroying thread; other threads release theirs on their next `get` from any pool,
+     or when they exit.
+     */
+    struct db_pool {
+        explicit db_pool(std::chrono::milliseconds idle_timeout = std::chrono::minutes(1));
+        db_pool(const db_pool&) = delete;
+        db_pool& operator=(const db_pool&) = delete;
+        // Releases the instances of the calling thread.
+        ~db_pool();
+
+        /// The calling thread's `db` for `config`, opened on first use and refreshed otherwise.
+        db get(const db_config& config);
+        /// Releases the calling thread's instances which have been idle for longer than the idle timeout.
+        void evict_idle();
+        /// Releases all instances of the calling thread.
+        void clear();
+
+        [[nodiscard]] db_pool_stats stats() const;
+
+    private:
+        const uint64_t m_id;
+        const std::chrono::milliseconds m_idle_timeout;
+        std::atomic<uint64_t> m_hits{0};
+        std::atomic<uint64_t> m_misses{0};
+        std::atomic<uint64_t> m_evictions{0};
+    };
+}
+
+#endif //CPPREALM_DB_POOL_HPP
@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef CPPREALM_EXPIRY_HPP
+#define CPPREALM_EXPIRY_HPP
+
+#include <cpprealm/db.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace realm {
+
+    /**
+     Counters describing the work done by an `expiry_sweeper`.
+     */
+    struct expiry_stats {
+        // The number of completed sweeps.
+        uint64_t sweeps = 0;
+        // The number of sweeps which stopped because of an error.
+        uint64_t failed_sweeps = 0;
+        // The number of objects deleted by all sweeps.
+        uint64_t deleted_objects = 0;
+        std::chrono::microseconds last_sweep_duration{0};
+        std::chrono::microseconds max_sweep_duration{0};
+    };
+
+    /**
+     Deletes expired objects on a background thread, for Realms which are used as a cache.
+
+     Rules are declared per type: `expire_after` removes objects whose timestamp property is
+     older than a time to live, and `limit_count` removes the oldest objects once a type
+     has more than a maximum number of them. Every `interval` the sweeper applies all rules,
+     deleting at most `batch_size` objects per write transaction so other writers are not
+     blocked for long.
+
+     The sweeper opens its own `db` from `config` on its thread.
+     */
+    struct expiry_sweeper {
+        expiry_sweeper(const db_config& config, std::chrono::milliseconds interval, size_t batch_size = 1000);
+        expiry_sweeper(const expiry_sweeper&) = delete;
+        expiry_sweeper& operator=(const expiry_sweeper&) = delete;
+        // Waits for a running sweep to finish.
+        ~expiry_sweeper();
+
+        /**
+         Deletes objects of type `T` whose timestamp `property` is earlier than `ttl` ago.
+         With a `ttl` of zero, `property` is treated as the time at which the object expires.
+         */
+        template <typename T>
+        void expire_after(const std::string& property, std::chrono::milliseconds ttl = std::chrono::milliseconds(0)) {
+            add_rule([property, ttl](db& realm, size_t batch_size) -> size_t {
+                auto cutoff = std::chrono::system_clock::now() - ttl;
+                auto expired = realm.objects<T>().where(property + " < $0", {cutoff}).sort(property, true);
+                return remove_first(realm, expired, batch_size);
+            });
+        }
+
+        /**
+         Keeps at most `max_objects` objects of type `T`. When there are more, the objects with
+         the smallest value of `property`, e.g. a creation or last access time, are deleted first.
+         */
+        template <typename T>
+        void limit_count(const std::string& property, size_t max_objects) {
+            add_rule([property, max_objects](db& realm, size_t batch_size) -> size_t {
+                auto objects = realm.objects<T>();
+                size_t count = objects.size();
+                if (count <= max_objects) {
+                    return 0;
+                }
+                auto oldest = objects.sort(property, true);
+                return remove_first(realm, oldest, std::min(batch_size, count - max_objects));
+            });
+        }
+
+        /// Runs a sweep now and returns once it has finished.
+        void sweep();
+
+        [[nodiscard]] expiry_stats stats() const;
+
+    private:
+        // Deletes one batch and returns the number of deleted objects, zero once there is nothing left to delete.
+        using rule = std::function<size_t(db&, size_t batch_size)>;
+
+        template <typename T>
+        static size_t remove_first(db& realm, results<T>& objects, size_t count) {
+            // The snapshot keeps the indices stable while objects are removed.
+            auto snapshot = objects.snapshot();
+            count = std::min(count, snapshot.size());
+            for (size_t i = 0; i < count; i++) {
+                auto object = snapshot[i];
+                realm.remove(object);
+            }
+            return count;
+        }
+
+        void add_rule(rule&& r);
+        void run(db_config config);
+        void run_sweep(db& realm);
+
+        const std::chrono::milliseconds m_interval;
+        const size_t m_batch_size;
+        mutable std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::vector<rule> m_rules;
+        expiry_stats m_stats;
+        uint64_t m_requested_sweeps = 0;
+        uint64_t m_completed_sweeps = 0;
+        bool m_stopping = false;
+        std::thread m_thread;
+    };
+}
+
+#endif //CPPREALM_EXPIRY_HPP
@@ -21,7 +21,9 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cpprealm/internal/bridge/utils.hpp>
 
@@ -118,9 +120,14 @@ namespace realm::internal::bridge {
         obj create_and_insert_linked_object(const std::string& key);
         obj create_and_insert_linked_object(const std::string& key, const internal::bridge::mixed& pk);
         mixed get(const std::string& key) const;
+        std::optional<mixed> try_get(const std::string& key) const;
         void erase(const std::string& key);
+        bool try_erase(const std::string& key);
         obj get_object(const std::string& key);
         std::pair<mixed, mixed> get_pair(size_t ndx) const;
+        /// Returns a view of the key at `ndx`. The view points into the Realm file
+        /// and is only valid until the next write or refresh.
+        std::string_view get_key(size_t ndx) const;
         size_t find_any_key(const std::string& value) const noexcept;
 
         size_t size() const;
@@ -45,6 +45,7 @@ namespace realm::internal::bridge {
     struct collection_change_callback;
     struct results;
     struct sort_descriptor;
+    struct query;
 
     struct list {
         list();
@@ -101,6 +102,8 @@ namespace realm::internal::bridge {
 
         results sort(const std::vector<sort_descriptor>&);
         [[nodiscard]] results as_results() const;
+        /// A query on the target table which only matches objects contained in this list.
+        [[nodiscard]] query get_query() const;
 
         notification_token add_notification_callback(std::shared_ptr<collection_change_callback>);
     private:
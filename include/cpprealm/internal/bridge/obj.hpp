@@ -172,6 +172,10 @@ namespace realm::internal::bridge {
             }
         }
 
+        /// Adds `value` to the integer in `col_key` as a single instruction. Sync merges concurrent
+        /// additions instead of keeping only the last written value.
+        void add_int(const col_key& col_key, int64_t value);
+
         void set_list_values(const col_key& col_key, const std::vector<obj_key>& values);
         void set_list_values(const col_key& col_key, const std::vector<std::string>& values);
         void set_list_values(const col_key& col_key, const std::vector<bool>& values);
@@ -224,6 +228,8 @@ namespace realm::internal::bridge {
         lnklst get_linklist(const col_key& col_key);
         core_dictionary get_dictionary(const col_key& col_key);
         void set_null(const col_key&);
+        /// Removes every element of the list, set or dictionary in `col_key`.
+        void clear_collection(const col_key&);
         obj create_and_set_linked_object(const col_key&);
         table_view get_backlink_view(table, col_key);
         void to_json(std::ostream& out) const noexcept;
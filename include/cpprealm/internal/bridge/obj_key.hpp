@@ -40,6 +40,7 @@ namespace realm::internal::bridge {
         obj_key& operator=(obj_key&& other) = default;
         ~obj_key() = default;
         operator ObjKey() const;
+        [[nodiscard]] int64_t value() const;
     private:
         int64_t m_obj_key;
     };
@@ -23,6 +23,7 @@
 #include <functional>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <cpprealm/internal/bridge/utils.hpp>
 
@@ -136,8 +137,13 @@ namespace realm::internal::bridge {
         [[nodiscard]] index_set modifications() const;
         [[nodiscard]] index_set insertions() const;
         [[nodiscard]] std::unordered_map<int64_t, index_set> columns() const;
+        /// The keys of the modified columns, without copying their index sets.
+        [[nodiscard]] std::vector<int64_t> column_keys() const;
         [[nodiscard]] bool empty() const;
         [[nodiscard]] bool collection_root_was_deleted() const;
+        /// Composes `next`, which must have been produced after this change set,
+        /// into this change set so that it describes both transitions at once.
+        void merge(const collection_change_set& next);
     private:
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         storage::CollectionChangeSet m_change_set[1];
@@ -170,7 +176,8 @@ namespace realm::internal::bridge {
 
         [[nodiscard]] bool is_valid() const;
 
-        notification_token add_notification_callback(std::shared_ptr<collection_change_callback>&& cb);
+        notification_token add_notification_callback(std::shared_ptr<collection_change_callback>&& cb,
+                                                     const std::vector<std::string>& key_paths = {});
 
         [[nodiscard]] object_schema get_object_schema() const;
 
@@ -21,6 +21,8 @@
 
 #include <cpprealm/internal/bridge/utils.hpp>
 
+#include <array>
+#include <chrono>
 #include <functional>
 #include <map>
 #include <memory>
@@ -57,6 +59,9 @@ namespace realm::internal::bridge {
     struct object_schema;
     struct table;
     struct dictionary;
+    struct list;
+    struct results;
+    struct set;
     struct thread_safe_reference;
     struct obj;
     struct object;
@@ -199,6 +204,17 @@ namespace realm::internal::bridge {
             void set_schema_version(uint64_t version);
             void set_encryption_key(const std::array<char, 64>&);
             void should_compact_on_launch(std::function<bool(uint64_t total_bytes, uint64_t unused_bytes)>&& fn);
+            /// Keep the data in memory only. It is shared by every instance opened with the same path
+            /// and discarded once the last one is closed. Nothing is written to or synced to disk.
+            void set_in_memory(bool in_memory);
+            [[nodiscard]] bool in_memory() const;
+            /// Fail with an error instead of growing the file once more than `max` versions are
+            /// pinned at the same time, e.g. by frozen Realms or thread safe references.
+            void set_max_number_of_active_versions(uint64_t max);
+            [[nodiscard]] uint64_t max_number_of_active_versions() const;
+            /// Whether both configs open the same file with the same schema and encryption key,
+            /// ignoring the scheduler and callbacks.
+            [[nodiscard]] bool opens_same_realm(const config& other) const;
             /// Open the Realm using the sync history mode even if a sync configuration is not supplied.
             /// This mode is used for opening a synced realm with a local realm config in the scenario
             /// that you do not have a valid sync user object.
@@ -239,24 +255,87 @@ namespace realm::internal::bridge {
         [[nodiscard]] struct schema schema() const;
         void begin_transaction() const;
         void commit_transaction() const;
+        void cancel_transaction() const;
+        [[nodiscard]] bool is_in_transaction() const;
         table table_for_object_type(const std::string& object_type);
         table get_table(const uint32_t &);
         [[nodiscard]] std::shared_ptr<struct scheduler> scheduler() const;
         static async_open_task get_synchronized_realm(const config&);
         bool refresh();
+        /// The version of the data this Realm currently reads.
+        [[nodiscard]] uint64_t read_transaction_version() const;
+        [[nodiscard]] bool auto_refresh() const;
+        void set_auto_refresh(bool);
         bool is_frozen() const;
+        /// Returns a frozen Realm at the current version. Freezing the same file at the same
+        /// version again, from any thread, returns the same instance while it is still in use.
         realm freeze(); // throws
         realm thaw(); // throws
         void close();
         bool is_closed();
         void invalidate();
         obj import_copy_of(const obj&) const;
+        /// Rewrites the file without free space. Returns false if the file is open elsewhere.
+        bool compact();
+        [[nodiscard]] struct file_stats file_stats() const;
+        /// Writes a compacted copy of the current version to `path`, which must not exist yet.
+        /// The copy is encrypted with `encryption_key` if one is given.
+        void write_copy(const std::string& path, const std::optional<std::array<char, 64>>& encryption_key) const;
         [[nodiscard]] std::optional<sync_session> get_sync_session() const;
     private:
+        // Throws if this handle has been closed.
+        const std::shared_ptr<Realm>& shared_realm() const;
+        // Null once a frozen handle has been closed, see `close()`.
         std::shared_ptr<Realm> m_realm;
         friend struct group;
+        friend bool operator==(const realm&, const realm&);
+        friend bool operator!=(const realm&, const realm&);
     };
 
+    /**
+     Space used by a Realm file.
+     */
+    struct file_stats {
+        // The size of the file, `used_bytes + free_bytes`.
+        uint64_t total_bytes = 0;
+        // The space used by live data, including versions which are still pinned by readers.
+        uint64_t used_bytes = 0;
+        // The space which is free and can be reclaimed by compacting.
+        uint64_t free_bytes = 0;
+        // The number of versions currently retained in the file.
+        uint64_t live_versions = 0;
+        // The number of objects of each type, by object type name.
+        std::map<std::string, size_t> objects_per_type;
+    };
+
+    /**
+     Statistics of the process-wide cache of frozen Realms.
+     */
+    struct frozen_realm_stats {
+        // The versions which are currently held by a frozen Realm, by file path.
+        std::map<std::string, std::vector<uint64_t>> pinned_versions;
+        // The number of freezes which reused a frozen Realm at the same version.
+        uint64_t hits = 0;
+        // The number of freezes which had to create a new frozen Realm.
+        uint64_t misses = 0;
+    };
+    frozen_realm_stats get_frozen_realm_stats();
+    void disable_sync_to_disk(bool disable);
+
+    /**
+     A version held by a cached frozen Realm. Versions pinned by thread safe references, live results or
+     notification tokens are not listed.
+     */
+    struct frozen_version {
+        std::string path;
+        uint64_t version = 0;
+        // The time since the version was frozen.
+        std::chrono::steady_clock::duration age{};
+        // The number of handles sharing the frozen Realm, e.g. frozen dbs, results and objects.
+        long handles = 0;
+    };
+    std::vector<frozen_version> get_frozen_versions();
+
     template<typename T>
     struct client_reset_mode_base {
     protected:
@@ -272,6 +351,12 @@ namespace realm::internal::bridge {
     dictionary resolve(const realm&, thread_safe_reference&& tsr);
     template <>
     object resolve(const realm&, thread_safe_reference&& tsr);
+    template <>
+    list resolve(const realm&, thread_safe_reference&& tsr);
+    template <>
+    results resolve(const realm&, thread_safe_reference&& tsr);
+    template <>
+    set resolve(const realm&, thread_safe_reference&& tsr);
 
     bool operator ==(const realm&, const realm&);
     bool operator !=(const realm&, const realm&);
@@ -20,7 +20,12 @@
 #define CPPREALM_BRIDGE_RESULTS_HPP
 
 #include <cstddef>
+#include <string>
+#include <vector>
+
+#include <cpprealm/internal/bridge/mixed.hpp>
 #include <cpprealm/internal/bridge/obj.hpp>
+#include <cpprealm/internal/bridge/obj_key.hpp>
 #include <cpprealm/internal/bridge/utils.hpp>
 
 namespace realm {
@@ -52,13 +57,30 @@ namespace realm::internal::bridge {
         ~results();
 
         results(const Results&); //NOLINT(google-explicit-constructor)
+        operator Results() const; //NOLINT(google-explicit-constructor)
         results(const realm&, const table_view&);
         size_t size();
         [[nodiscard]] realm get_realm() const;
         [[nodiscard]] table get_table() const;
         results(const realm&, const query&);
         results sort(const std::vector<sort_descriptor>&);
-        notification_token add_notification_callback(std::shared_ptr<collection_change_callback>&&);
+        results distinct(const std::vector<std::string>& key_paths);
+        /// The query backing these results, so that further conditions stay scoped to them.
+        [[nodiscard]] query get_query() const;
+        std::optional<mixed> min(const col_key&);
+        std::optional<mixed> max(const col_key&);
+        std::optional<mixed> sum(const col_key&);
+        std::optional<mixed> average(const col_key&);
+        /// A copy of these results which keeps the current matches instead of re-running the query.
+        [[nodiscard]] results snapshot() const;
+        /// These results, imported into the frozen `realm`. The query and sort order are kept.
+        [[nodiscard]] results freeze(const realm&) const;
+        /// The keys of the objects in these results, in order.
+        std::vector<obj_key> get_keys();
+        /// Only changes to the properties named in `key_paths` trigger the callback. An empty
+        /// list observes every property, as well as insertions and deletions.
+        notification_token add_notification_callback(std::shared_ptr<collection_change_callback>&&,
+                                                     const std::vector<std::string>& key_paths = {});
     private:
         template <typename T>
         friend T get(results&, size_t);
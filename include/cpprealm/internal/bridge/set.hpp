@@ -44,6 +44,7 @@ namespace realm::internal::bridge {
     struct table;
     struct notification_token;
     struct collection_change_callback;
+    struct results;
 
     struct set {
         set();
@@ -60,6 +61,7 @@ namespace realm::internal::bridge {
         obj get_obj(const size_t& i) const;
 
         [[nodiscard]] size_t size() const;
+        [[nodiscard]] results as_results() const;
         void remove_all();
 
         table get_table() const;
@@ -96,6 +98,16 @@ namespace realm::internal::bridge {
         size_t find(const timestamp &);
         size_t find(const binary&);
         size_t find(const obj_key&);
+
+        [[nodiscard]] bool is_subset_of(const set&) const;
+        [[nodiscard]] bool is_superset_of(const set&) const;
+        [[nodiscard]] bool intersects(const set&) const;
+        [[nodiscard]] bool set_equals(const set&) const;
+        void assign_union(const set&);
+        void assign_intersection(const set&);
+        void assign_difference(const set&);
+        void assign_symmetric_difference(const set&);
+
         notification_token add_notification_callback(std::shared_ptr<collection_change_callback>);
     private:
         const object_store::Set* get_set() const;
@@ -19,6 +19,7 @@
 #ifndef CPPREALM_BRIDGE_TABLE_HPP
 #define CPPREALM_BRIDGE_TABLE_HPP
 
+#include <optional>
 #include <string>
 #include <vector>
 #include <cpprealm/internal/bridge/obj_key.hpp>
@@ -57,6 +58,17 @@ namespace realm {
 
             obj create_object(const obj_key &obj_key = {}) const;
 
+            /// Copies `source`, which may belong to another Realm with the same schema for this table,
+            /// into a new object or the object with the same primary key. Embedded objects are copied and
+            /// links point to the object with the same primary key in this table's Realm. Linked objects
+            /// which don't exist there yet are created with only their primary key. If `created_links` is
+            /// given, each distinct link target which has no object with its primary key in this table's
+            /// Realm before the copy is added to it.
+            obj copy_object(const obj &source, size_t *created_links = nullptr) const;
+
+            /// Looks `key` up in the primary key index. Returns `std::nullopt` if no object has this primary key.
+            std::optional<obj_key> find_primary_key(const mixed &key) const;
+
             table get_link_target(const col_key col_key) const;
             link_chain get_link(const col_key col_key) const;
 
@@ -68,6 +80,9 @@ namespace realm {
             void remove_object(const obj_key &) const;
             obj get_object(const obj_key&) const;
             bool is_valid(const obj_key&) const;
+            /// The location of the table's data in the file. Writing to the table moves it, so an
+            /// unchanged value means the table wasn't written to in between.
+            [[nodiscard]] uint64_t storage_ref() const;
             using underlying = TableRef;
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         storage::TableRef m_table[1];
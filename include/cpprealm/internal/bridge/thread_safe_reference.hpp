@@ -27,7 +27,10 @@ namespace realm {
 namespace realm::internal::bridge {
     struct object;
     struct dictionary;
+    struct list;
     struct realm;
+    struct results;
+    struct set;
 
     struct thread_safe_reference {
         thread_safe_reference();
@@ -38,6 +41,9 @@ namespace realm::internal::bridge {
         ~thread_safe_reference();
         thread_safe_reference(const object&);
         thread_safe_reference(const dictionary&);
+        thread_safe_reference(const list&);
+        thread_safe_reference(const results&);
+        thread_safe_reference(const set&);
         thread_safe_reference(ThreadSafeReference&&);
         operator ThreadSafeReference&&();
         operator bool() const; //NOLINT(google-explicit-constructor)
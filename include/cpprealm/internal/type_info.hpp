@@ -32,6 +32,7 @@
 #include <cpprealm/internal/bridge/set.hpp>
 
 #include <map>
+#include <set>
 #include <vector>
 
 namespace realm {
@@ -165,6 +166,16 @@ namespace realm::internal::type_info {
     struct is_backlink<linking_objects<T>> : std::true_type {
         static constexpr auto value = true;
     };
+
+    // Whether a stored value of type T can be detached and compared with an unmanaged value.
+    template <typename T>
+    struct is_comparable_for_update : std::negation<std::disjunction<is_link<T>, is_backlink<T>>> {};
+    template <typename T>
+    struct is_comparable_for_update<std::vector<T>> : is_comparable_for_update<T> {};
+    template <typename T>
+    struct is_comparable_for_update<std::set<T>> : is_comparable_for_update<T> {};
+    template <typename T>
+    struct is_comparable_for_update<std::map<std::string, T>> : is_comparable_for_update<T> {};
     template <>
     struct type_info<std::monostate> {
         using internal_type = std::monostate;
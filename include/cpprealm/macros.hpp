@@ -517,12 +517,13 @@ rbool managed<std::optional<type>>::operator op(const std::optional<type>& rhs)
             }, zipped);                                                                             \
             return v;                                                                               \
         }                                                                                           \
-        auto observe(std::function<void(realm::object_change<managed>&&)>&& fn) {                   \
+        auto observe(std::function<void(realm::object_change<managed>&&)>&& fn,                    \
+                     const realm::observe_options& options = {}) {                                  \
             auto m_object = std::make_shared<internal::bridge::object>(m_realm, m_obj);             \
-            auto wrapper = realm::object_change_callback_wrapper<managed>{                          \
-            std::move(fn), this, m_object};                                                         \
             return m_object->add_notification_callback(                                             \
-            std::make_shared<realm::object_change_callback_wrapper<managed>>(wrapper));             \
+            std::make_shared<realm::object_change_callback_wrapper<managed>>(                       \
+            std::move(fn), this, m_object, options, m_realm.scheduler()),                           \
+            options.key_paths);                                                                     \
         }                                                                                           \
         bool is_invalidated() {                                                                     \
             return !m_obj.is_valid();                                                               \
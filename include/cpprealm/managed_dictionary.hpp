@@ -556,7 +556,7 @@ namespace realm {
 
             std::pair<std::string, T> operator*() noexcept
             {
-                auto pair = m_parent->m_obj->get_dictionary(m_parent->m_key).get_pair(m_i);
+                auto pair = m_parent->get_dictionary().get_pair(m_i);
                 return { pair.first, deserialize<T>(pair.second) };
             }
 
@@ -583,9 +583,59 @@ namespace realm {
             const managed<std::map<std::string, T>>* m_parent;
         };
 
+        /// Iterates the keys of the dictionary without copying them.
+        /// The yielded views are only valid until the next write or refresh.
+        class key_iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::string_view;
+
+            bool operator!=(const key_iterator& other) const
+            {
+                return !(*this == other);
+            }
+
+            bool operator==(const key_iterator& other) const
+            {
+                return (m_parent == other.m_parent) && (m_i == other.m_i);
+            }
+
+            std::string_view operator*() const
+            {
+                return m_parent->get_dictionary().get_key(m_i);
+            }
+
+            key_iterator& operator++()
+            {
+                this->m_i++;
+                return *this;
+            }
+        private:
+            template<typename, typename>
+            friend struct managed;
+
+            key_iterator(size_t i, const managed<std::map<std::string, T>>* parent)
+                : m_i(i), m_parent(parent)
+            {
+            }
+            size_t m_i;
+            const managed<std::map<std::string, T>>* m_parent;
+        };
+
+        struct key_view {
+            key_iterator begin() const { return key_iterator(0, m_parent); }
+            key_iterator end() const { return key_iterator(m_parent->size(), m_parent); }
+            const managed<std::map<std::string, T>>* m_parent;
+        };
+
+        key_view keys() const
+        {
+            return key_view{this};
+        }
+
         size_t size() const
         {
-            return m_obj->get_dictionary(m_key).size();
+            return get_dictionary().size();
         }
 
         iterator begin() const
@@ -603,8 +653,7 @@ namespace realm {
                 throw std::runtime_error("`find` is not available in Type Safe Queries, use `contains_key` instead.");
             }
             // Dictionary's `find` searches for the index of the value and not the key.
-            auto d = m_obj->get_dictionary(m_key);
-            auto i = d.find_any_key(key);
+            auto i = get_dictionary().find_any_key(key);
             if (i == size_t(-1)) {
                 return iterator(size(), this);
             } else {
@@ -617,17 +666,51 @@ namespace realm {
                 if (m_rbool_query) {
                     return box<managed<T>>(m_rbool_query, m_key, key, *m_realm);
                 }
-                return box<managed<T>>(m_obj->get_dictionary(m_key), key, *m_realm);
+                return box<managed<T>>(internal::bridge::core_dictionary(get_dictionary()), key, *m_realm);
             } else {
                 if (m_rbool_query) {
                     return box<T>(m_rbool_query, m_key, key, *m_realm);
                 }
-                return box<T>(m_obj->get_dictionary(m_key), key, *m_realm);
+                return box<T>(internal::bridge::core_dictionary(get_dictionary()), key, *m_realm);
             }
         }
 
         void erase(const std::string& key) {
-            m_obj->get_dictionary(m_key).erase(key);
+            get_dictionary().erase(key);
+        }
+
+        /// Inserts or overwrites every key/value pair in `values`.
+        void insert_many(const std::map<std::string, T>& values) {
+            static_assert(internal::type_info::is_primitive<T>::value, "insert_many only supports primitive values.");
+            auto& d = get_dictionary();
+            for (auto& [k, v] : values) {
+                d.insert(k, serialize(v));
+            }
+        }
+
+        /// Returns the values for each of `keys` that is present in the dictionary.
+        std::map<std::string, T> get_many(const std::vector<std::string>& keys) const {
+            static_assert(internal::type_info::is_primitive<T>::value, "get_many only supports primitive values.");
+            auto& d = get_dictionary();
+            std::map<std::string, T> ret;
+            for (auto& k : keys) {
+                if (auto v = d.try_get(k)) {
+                    ret.emplace(k, deserialize<T>(*v));
+                }
+            }
+            return ret;
+        }
+
+        /// Removes each of `keys` from the dictionary and returns the number of keys that were present.
+        size_t erase_many(const std::vector<std::string>& keys) {
+            auto& d = get_dictionary();
+            size_t count = 0;
+            for (auto& k : keys) {
+                if (d.try_erase(k)) {
+                    ++count;
+                }
+            }
+            return count;
         }
 
         /// Convenience method to be primarily used in type safe queries.
@@ -635,7 +718,7 @@ namespace realm {
             if (m_rbool_query) {
                 return m_rbool_query->dictionary_has_key(m_key, key);
             } else {
-                return m_obj->get_dictionary(m_key).find_any_key(key) != size_t(-1);
+                return get_dictionary().find_any_key(key) != size_t(-1);
             }
         }
 
@@ -650,7 +733,24 @@ namespace realm {
             return token;
         }
 
+        void assign(internal::bridge::obj *obj,
+                    internal::bridge::realm* realm,
+                    const internal::bridge::col_key &key) {
+            managed_base::assign(obj, realm, key);
+            m_dictionary.reset();
+        }
+
     private:
+        // The dictionary accessor is created on first use and reused for the lifetime
+        // of this property, the core keeps it in sync with the current version.
+        internal::bridge::core_dictionary& get_dictionary() const {
+            if (!m_dictionary) {
+                m_dictionary = m_obj->get_dictionary(m_key);
+            }
+            return *m_dictionary;
+        }
+        mutable std::optional<internal::bridge::core_dictionary> m_dictionary;
+
         managed() = default;
         managed(const managed&) = delete;
         managed(managed &&) = delete;
@@ -342,30 +342,42 @@ namespace realm {
             std::vector<internal::bridge::mixed> mixed_args;
             for(auto& a : arguments)
                 mixed_args.push_back(serialize(a));
-            return results<T>(internal::bridge::results(*m_realm, m_obj->get_target_table(m_key).query(query, std::move(mixed_args))));
+            auto list = internal::bridge::list(*m_realm, *m_obj, m_key);
+            auto scoped_query = list.get_query().and_query(m_obj->get_target_table(m_key).query(query, std::move(mixed_args)));
+            return results<T>(internal::bridge::results(*m_realm, scoped_query));
         }
 
         results<T> where(std::function<rbool(managed<T> &)> &&fn) {
             static_assert(sizeof(managed<T>), "Must declare schema for T");
-            auto schema = m_realm->schema().find(managed<T>::schema.name);
-            auto group = m_realm->read_group();
-            auto table_ref = group.get_table(schema.table_key());
-            rbool query = rbool(internal::bridge::query(table_ref));
+            rbool query = rbool(internal::bridge::list(*m_realm, *m_obj, m_key).get_query());
             auto query_object = managed<T>::prepare_for_query(*m_realm, &query);
             auto full_query = fn(query_object).q;
             return results<T>(internal::bridge::results(*m_realm, full_query));
         }
 
         results<T> sort(const std::string &key_path, bool ascending) {
-            auto schema = m_realm->schema().find(managed<T>::schema.name);
-            auto table_ref = m_obj->get_target_table(m_key);
-            return results<T>(internal::bridge::results(*m_realm, table_ref)).sort({{key_path, ascending}});
+            return results<T>(internal::bridge::list(*m_realm, *m_obj, m_key).sort({{key_path, ascending}}));
         }
 
         results<T> sort(const std::vector<internal::bridge::sort_descriptor> &sort_descriptors) {
-            auto schema = m_realm->schema().find(managed<T>::schema.name);
-            auto table_ref = m_obj->get_target_table(m_key);
-            return results<T>(internal::bridge::results(*m_realm, table_ref)).sort(sort_descriptors);
+            return results<T>(internal::bridge::list(*m_realm, *m_obj, m_key).sort(sort_descriptors));
+        }
+
+        results<T> distinct(const std::vector<std::string> &key_paths) {
+            return results<T>(internal::bridge::list(*m_realm, *m_obj, m_key).as_results().distinct(key_paths));
+        }
+
+        std::optional<realm::mixed> min(const std::string &property) {
+            return as_results().min(property);
+        }
+        std::optional<realm::mixed> max(const std::string &property) {
+            return as_results().max(property);
+        }
+        std::optional<realm::mixed> sum(const std::string &property) {
+            return as_results().sum(property);
+        }
+        std::optional<realm::mixed> average(const std::string &property) {
+            return as_results().average(property);
         }
 
     private:
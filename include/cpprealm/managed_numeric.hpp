@@ -92,31 +92,34 @@ namespace realm {
             return serialize(detach()) <= rhs;
         }
 
+        /// Adds `value` without reading the current value first. Concurrent increments
+        /// from other devices are merged by sync rather than overwritten.
+        void increment(int64_t value = 1) {
+            m_obj->add_int(m_key, value);
+        }
+        void decrement(int64_t value = 1) {
+            m_obj->add_int(m_key, -value);
+        }
+
         managed& operator+=(const int64_t& o) {
-            auto old_val = m_obj->template get<int64_t>(m_key);
-            m_obj->template set<int64_t>(this->m_key, old_val + o);
+            increment(o);
             return *this;
         }
         void operator++(int) {
-            auto old_val = m_obj->template get<int64_t>(m_key);
-            m_obj->template set<int64_t>(this->m_key, old_val + 1);
+            increment();
         }
         void operator++() {
-            auto old_val = m_obj->template get<int64_t>(m_key);
-            m_obj->template set<int64_t>(this->m_key, old_val + 1);
+            increment();
         }
         managed& operator-=(const int64_t& o) {
-            auto old_val = m_obj->template get<int64_t>(m_key);
-            m_obj->template set<int64_t>(this->m_key, old_val - o);
+            decrement(o);
             return *this;
         }
         void operator--(int) {
-            auto old_val = m_obj->template get<int64_t>(m_key);
-            m_obj->template set<int64_t>(this->m_key, old_val - 1);
+            decrement();
         }
         void operator--() {
-            auto old_val = m_obj->template get<int64_t>(m_key);
-            m_obj->template set<int64_t>(this->m_key, old_val - 1);
+            decrement();
         }
         managed& operator*=(const int64_t& o) {
             auto old_val = m_obj->template get<int64_t>(m_key);
@@ -142,6 +142,63 @@ namespace realm {
                 return iterator(size(), this);
             return iterator(idx, this);
         }
+
+        /// Replaces the contents of this set with the union of this set and `other`.
+        void union_with(const managed<std::set<T>>& other)
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            set.assign_union(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
+        /// Removes all elements from this set which are not also contained in `other`.
+        void intersect_with(const managed<std::set<T>>& other)
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            set.assign_intersection(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
+        /// Removes all elements from this set which are contained in `other`.
+        void subtract(const managed<std::set<T>>& other)
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            set.assign_difference(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
+        /// Replaces the contents of this set with the elements which are contained in either this set or `other`, but not both.
+        void symmetric_difference_with(const managed<std::set<T>>& other)
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            set.assign_symmetric_difference(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
+        /// Returns true if every element of this set is also contained in `other`.
+        bool is_subset_of(const managed<std::set<T>>& other) const
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            return set.is_subset_of(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
+        /// Returns true if every element of `other` is also contained in this set.
+        bool is_superset_of(const managed<std::set<T>>& other) const
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            return set.is_superset_of(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
+        /// Returns true if this set and `other` have at least one element in common.
+        bool intersects(const managed<std::set<T>>& other) const
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            return set.intersects(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
+        /// Returns true if this set and `other` contain the same elements.
+        bool set_equals(const managed<std::set<T>>& other) const
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            return set.set_equals(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
         void clear() {
             internal::bridge::set(*m_realm, *m_obj, m_key).remove_all();
         }
@@ -352,6 +409,63 @@ namespace realm {
                 return iterator(size(), this);
             return iterator(idx, this);
         }
+
+        /// Replaces the contents of this set with the union of this set and `other`.
+        void union_with(const managed<std::set<T*>>& other)
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            set.assign_union(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
+        /// Removes all elements from this set which are not also contained in `other`.
+        void intersect_with(const managed<std::set<T*>>& other)
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            set.assign_intersection(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
+        /// Removes all elements from this set which are contained in `other`.
+        void subtract(const managed<std::set<T*>>& other)
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            set.assign_difference(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
+        /// Replaces the contents of this set with the elements which are contained in either this set or `other`, but not both.
+        void symmetric_difference_with(const managed<std::set<T*>>& other)
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            set.assign_symmetric_difference(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
+        /// Returns true if every element of this set is also contained in `other`.
+        bool is_subset_of(const managed<std::set<T*>>& other) const
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            return set.is_subset_of(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
+        /// Returns true if every element of `other` is also contained in this set.
+        bool is_superset_of(const managed<std::set<T*>>& other) const
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            return set.is_superset_of(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
+        /// Returns true if this set and `other` have at least one element in common.
+        bool intersects(const managed<std::set<T*>>& other) const
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            return set.intersects(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
+        /// Returns true if this set and `other` contain the same elements.
+        bool set_equals(const managed<std::set<T*>>& other) const
+        {
+            auto set = internal::bridge::set(*m_realm, *m_obj, m_key);
+            return set.set_equals(internal::bridge::set(*other.m_realm, *other.m_obj, other.m_key));
+        }
+
         void clear() {
             internal::bridge::set(*m_realm, *m_obj, m_key).remove_all();
         }
@@ -19,14 +19,18 @@
 #ifndef notifications_hpp
 #define notifications_hpp
 
+#include <cpprealm/scheduler.hpp>
 #include <cpprealm/thread_safe_reference.hpp>
 #include <cpprealm/internal/bridge/dictionary.hpp>
 #include <cpprealm/internal/bridge/list.hpp>
 #include <cpprealm/internal/bridge/set.hpp>
 
 #include <any>
+#include <chrono>
 #include <future>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace realm {
 template <typename T>
@@ -72,6 +76,115 @@ struct notification_token {
     internal::bridge::realm m_realm;
 };
 
+/**
+ Options which control when a notification callback is invoked.
+ */
+struct observe_options {
+    /**
+     The minimum time between two deliveries. Changes which are committed sooner
+     are merged and delivered together once the interval has passed.
+     */
+    std::chrono::milliseconds min_interval = std::chrono::milliseconds(0);
+
+    /**
+     Deliver as soon as this many changes have been merged, even if `min_interval`
+     has not passed yet. Zero means there is no limit.
+
+     Without a `min_interval` nothing else delivers a partial batch, so changes are held
+     until `max_batch` of them have accumulated. Set both to bound how long changes wait.
+     */
+    size_t max_batch = 0;
+
+    /**
+     Only notify when one of these properties changes, e.g. `{"name", "dog.age"}`.
+     Insertions and deletions of observed results are always reported. An empty
+     list observes every property.
+     */
+    std::vector<std::string> key_paths;
+
+    /**
+     If set, callbacks are invoked on this scheduler instead of the thread which
+     registered the observer. Change indices and primitive property values can be
+     read there, but linked objects must only be accessed on the observing thread.
+     The observed object or collection is not passed to the callback, and changes
+     which are still queued when the token is released are dropped.
+     */
+    std::shared_ptr<scheduler> delivery_scheduler;
+};
+
+namespace internal {
+    struct timer_queue;
+
+    /**
+     Invokes a function on a scheduler once a delay has elapsed. The delays of every
+     `delayed_invoker` in the process are tracked by a single thread. A pending
+     invocation is cancelled when the invoker is destroyed.
+     */
+    struct delayed_invoker {
+        delayed_invoker() = default;
+        delayed_invoker(const delayed_invoker&) = delete;
+        delayed_invoker& operator=(const delayed_invoker&) = delete;
+        ~delayed_invoker();
+
+        /// Invokes `fn` on `scheduler` once `delay` has elapsed, replacing a pending invocation.
+        void invoke_after(const std::shared_ptr<scheduler>& scheduler,
+                          std::chrono::milliseconds delay,
+                          std::function<void()>&& fn);
+        void cancel();
+
+    private:
+        std::shared_ptr<timer_queue> m_queue;
+        uint64_t m_timer = 0;
+    };
+
+    /**
+     Tracks how many changes are waiting to be delivered to a callback and decides,
+     based on the `observe_options`, whether they should be delivered now.
+     */
+    struct notification_throttle {
+        notification_throttle() = default;
+        explicit notification_throttle(const observe_options& options)
+            : m_options(options) {}
+
+        [[nodiscard]] bool is_enabled() const noexcept {
+            return m_options.min_interval.count() > 0 || m_options.max_batch > 1;
+        }
+
+        // Records one more pending change and returns true if the pending
+        // changes should be delivered immediately.
+        bool record() {
+            ++m_pending;
+            if (m_options.max_batch > 0 && m_pending >= m_options.max_batch) {
+                return true;
+            }
+            return m_options.min_interval.count() > 0 && remaining().count() == 0;
+        }
+
+        void did_deliver() {
+            m_pending = 0;
+            m_last_delivery = std::chrono::steady_clock::now();
+        }
+
+        [[nodiscard]] bool has_pending() const noexcept {
+            return m_pending > 0;
+        }
+
+        // The time left until `min_interval` has passed since the last delivery.
+        [[nodiscard]] std::chrono::milliseconds remaining() const {
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_last_delivery);
+            return elapsed >= m_options.min_interval ? std::chrono::milliseconds(0) : m_options.min_interval - elapsed;
+        }
+
+        // Set while a delayed flush has been requested from the scheduler.
+        bool flush_scheduled = false;
+
+    private:
+        observe_options m_options;
+        size_t m_pending = 0;
+        std::chrono::steady_clock::time_point m_last_delivery;
+    };
+}
+
 // MARK: PropertyChange
 /**
  Information about a specific property which changed in an `realm::object` change notification.
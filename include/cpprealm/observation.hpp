@@ -24,11 +24,14 @@
 #include <cpprealm/internal/bridge/object.hpp>
 #include <cpprealm/internal/bridge/realm.hpp>
 #include <cpprealm/macros.hpp>
+#include <cpprealm/notifications.hpp>
 
 #include <cpprealm/internal/bridge/table.hpp>
 #include <cpprealm/internal/bridge/thread_safe_reference.hpp>
 
+#include <algorithm>
 #include <iostream>
+#include <unordered_map>
 #include <variant>
 
 namespace realm {
@@ -36,7 +39,8 @@ namespace realm {
     template<typename T>
     struct object_change {
         using underlying = T;
-        /// The object being observed.
+        /// The object being observed. This is null when the change is delivered on an
+        /// `observe_options::delivery_scheduler`.
         const T *object;
         /// The object has been deleted from the Realm.
         bool is_deleted = false;
@@ -55,45 +59,67 @@ namespace realm {
     };
 
     template<typename T>
-    struct object_change_callback_wrapper : internal::bridge::collection_change_callback {
+    struct object_change_callback_wrapper : internal::bridge::collection_change_callback,
+                                            std::enable_shared_from_this<object_change_callback_wrapper<T>> {
         object_change_callback_wrapper(std::function<void(object_change < T > )> &&b,
                                     const T *obj,
-                                    std::shared_ptr<internal::bridge::object> internal_object)
-                : block(std::move(b)), object(*obj), m_object(internal_object) {
+                                    std::shared_ptr<internal::bridge::object> internal_object,
+                                    const observe_options& options = {},
+                                    std::shared_ptr<scheduler> scheduler = nullptr)
+                : block(std::move(b)), object(*obj), m_object(internal_object),
+                  m_throttle(options), m_scheduler(std::move(scheduler)),
+                  m_delivery_scheduler(options.delivery_scheduler) {
             static_cast<void>(obj);
+            // Resolve the column keys once so that each change only needs a lookup per modified column.
+            auto table = m_object->get_obj().get_table();
+            for (size_t i = 0; i < std::tuple_size<decltype(T::schema.properties)>{}; i++) {
+                m_property_index_for_column[table.get_column_key(T::schema.names[i]).value()] = i;
+            }
         }
         std::function<void(object_change<T>)> block;
         const T object;
         std::shared_ptr<internal::bridge::object> m_object;
+        internal::notification_throttle m_throttle;
+        std::shared_ptr<scheduler> m_scheduler;
+        std::shared_ptr<scheduler> m_delivery_scheduler;
+        std::unordered_map<int64_t, size_t> m_property_index_for_column;
+        // Property changes waiting to be delivered when notifications are throttled.
+        std::vector<PropertyChange<T>> m_pending_changes;
+        internal::delayed_invoker m_flush_timer;
 
         std::optional<std::vector<std::string>> property_names = std::nullopt;
+        std::optional<std::vector<size_t>> property_indices = std::nullopt;
         std::optional<std::vector<typename decltype(T::schema)::variant_t>> old_values = std::nullopt;
         bool deleted = false;
 
         void populate_properties(internal::bridge::collection_change_set const &c) {
-            if (property_names) {
+            if (property_indices) {
                 return;
             }
             if (!c.deletions().empty()) {
                 deleted = true;
                 return;
             }
-            if (c.columns().empty()) {
-                return;
-            }
 
-            auto properties = std::vector<std::string>();
-            auto table = m_object->get_obj().get_table();
-
-            for (auto i = 0; i < std::tuple_size<decltype(T::schema.properties)>{}; i++) {
-                if (c.columns().count(table.get_column_key(T::schema.names[i]).value())) {
-                    properties.push_back(T::schema.names[i]);
+            auto indices = std::vector<size_t>();
+            for (auto key: c.column_keys()) {
+                if (auto it = m_property_index_for_column.find(key); it != m_property_index_for_column.end()) {
+                    indices.push_back(it->second);
                 }
             }
+            if (indices.empty()) {
+                return;
+            }
+            // Report properties in declaration order regardless of the order core tracked them in.
+            std::sort(indices.begin(), indices.end());
 
-            if (!properties.empty()) {
-                property_names = properties;
+            auto names = std::vector<std::string>();
+            names.reserve(indices.size());
+            for (auto i: indices) {
+                names.emplace_back(T::schema.names[i]);
             }
+            property_indices = std::move(indices);
+            property_names = std::move(names);
         }
 
         std::optional<std::vector<typename decltype(T::schema)::variant_t>>
@@ -102,14 +128,14 @@ namespace realm {
                 return std::nullopt;
             }
             populate_properties(c);
-            if (!property_names) {
+            if (!property_indices) {
                 return std::nullopt;
             }
 
             std::vector<typename decltype(T::schema)::variant_t> values;
-            for (auto &name: *property_names) {
-                auto value = T::schema.property_value_for_name(name, object, true);
-                values.push_back(value);
+            values.reserve(property_indices->size());
+            for (auto i: *property_indices) {
+                values.push_back(T::schema.property_value_for_index(i, object, true));
             }
             return values;
         }
@@ -121,18 +147,83 @@ namespace realm {
         void after(internal::bridge::collection_change_set const &c) override {
             auto new_values = read_values(c);
             if (deleted) {
+                m_pending_changes.clear();
                 forward_change(nullptr, {}, {}, {}, nullptr);
-            } else if (new_values) {
+            } else if (new_values && !m_throttle.is_enabled()) {
                 forward_change(&object,
                                *property_names,
                                old_values ? *old_values : std::vector<typename decltype(T::schema)::variant_t>{},
                                *new_values,
                                nullptr);
+            } else if (new_values) {
+                merge_pending(*property_names, old_values, *new_values);
+                if (m_throttle.record()) {
+                    flush();
+                } else if (!m_throttle.flush_scheduled && m_scheduler) {
+                    m_throttle.flush_scheduled = true;
+                    m_flush_timer.invoke_after(m_scheduler, m_throttle.remaining(), [weak = this->weak_from_this()]() {
+                        if (auto self = weak.lock()) {
+                            self->m_throttle.flush_scheduled = false;
+                            self->flush();
+                        }
+                    });
+                }
             }
             property_names = std::nullopt;
+            property_indices = std::nullopt;
             old_values = std::nullopt;
         }
 
+        // Keeps the oldest `old_value` and the newest `new_value` for each changed property.
+        void merge_pending(const std::vector<std::string>& names,
+                           const std::optional<std::vector<typename decltype(T::schema)::variant_t>>& previous,
+                           const std::vector<typename decltype(T::schema)::variant_t>& current) {
+            for (size_t i = 0; i < names.size(); i++) {
+                auto it = std::find_if(m_pending_changes.begin(), m_pending_changes.end(), [&](auto& p) {
+                    return p.name == names[i];
+                });
+                if (it == m_pending_changes.end()) {
+                    PropertyChange<T> property;
+                    property.name = names[i];
+                    if (previous) {
+                        property.old_value = (*previous)[i];
+                    }
+                    property.new_value = current[i];
+                    m_pending_changes.push_back(std::move(property));
+                } else {
+                    it->new_value = current[i];
+                }
+            }
+        }
+
+        void flush() {
+            if (!m_throttle.has_pending() || m_pending_changes.empty()) {
+                return;
+            }
+            m_throttle.did_deliver();
+            auto oc = object_change<T>();
+            oc.object = &object;
+            oc.property_changes = std::move(m_pending_changes);
+            m_pending_changes.clear();
+            deliver(std::move(oc));
+        }
+
+        void deliver(object_change<T>&& oc) {
+            if (!m_delivery_scheduler) {
+                block(std::move(oc));
+                return;
+            }
+            // The object is owned by this wrapper, which is destroyed with the token and
+            // can't be read from another thread, so it is never passed to another scheduler.
+            oc.object = nullptr;
+            auto change = std::make_shared<object_change<T>>(std::move(oc));
+            m_delivery_scheduler->invoke([change, weak = this->weak_from_this()]() {
+                if (auto self = weak.lock()) {
+                    self->block(std::move(*change));
+                }
+            });
+        }
+
         void error(std::exception_ptr err) {
             forward_change(nullptr, {}, {}, {}, err);
         }
@@ -146,11 +237,11 @@ namespace realm {
                 if (error) {
                     auto oc = object_change<T>();
                     oc.error = error;
-                    block(std::forward<realm::object_change<T>>(std::move(oc)));
+                    deliver(std::move(oc));
                 } else {
                     auto oc = object_change<T>();
                     oc.is_deleted = true;
-                    block(std::forward<realm::object_change<T>>(std::move(oc)));
+                    deliver(std::move(oc));
                 }
             } else {
                 std::vector<PropertyChange<T>> property_changes;
@@ -167,8 +258,8 @@ namespace realm {
                 }
                 auto oc = object_change<T>();
                 oc.object = ptr;
-                oc.property_changes = property_changes;
-                block(std::forward<realm::object_change<T>>(std::move(oc)));
+                oc.property_changes = std::move(property_changes);
+                deliver(std::move(oc));
             }
         }
     };
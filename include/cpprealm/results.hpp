@@ -19,6 +19,11 @@
 #ifndef CPPREALM_RESULTS_HPP
 #define CPPREALM_RESULTS_HPP
 
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <vector>
+
 #include <cpprealm/internal/bridge/mixed.hpp>
 #include <cpprealm/internal/bridge/query.hpp>
 #include <cpprealm/internal/bridge/results.hpp>
@@ -32,6 +37,17 @@ namespace realm {
     struct mutable_sync_subscription_set;
 }
 
+namespace realm::internal {
+    /**
+     Calls `fn(chunk)` for every chunk index in `[0, chunk_count)`, spreading the chunks over
+     up to `concurrency` threads (the calling thread included). Threads take the next chunk
+     as they finish one, so uneven chunks do not leave threads idle. Zero concurrency uses
+     `std::thread::hardware_concurrency()`. The first exception thrown by `fn` is rethrown
+     once all threads have stopped.
+     */
+    void parallel_for_chunks(size_t chunk_count, size_t concurrency, const std::function<void(size_t)>& fn);
+}
+
 namespace realm {
 
     using sort_descriptor = internal::bridge::sort_descriptor;
@@ -49,6 +65,8 @@ namespace realm {
             : m_parent(parent) {
         }
         struct results_change {
+            // The observed results. This is null when the change is delivered on an
+            // `observe_options::delivery_scheduler`.
             Derived *collection;
             std::vector<uint64_t> deletions;
             std::vector<uint64_t> insertions;
@@ -74,40 +92,92 @@ namespace realm {
             std::vector<internal::bridge::mixed> mixed_args;
             for(auto& a : arguments)
                 mixed_args.push_back(serialize(a));
-            return Derived(internal::bridge::results(m_parent.get_realm(),
-                                                     m_parent.get_table().query(query, std::move(mixed_args))));
+            auto scoped_query = m_parent.get_query().and_query(m_parent.get_table().query(query, std::move(mixed_args)));
+            return Derived(internal::bridge::results(m_parent.get_realm(), scoped_query));
         }
 
         Derived where(std::function<rbool(managed<T>&)>&& fn) {
             static_assert(sizeof(managed<T>), "Must declare schema for T");
             auto realm = m_parent.get_realm();
-            auto schema = realm.schema().find(managed<T>::schema.name);
-            auto group = realm.read_group();
-            auto table_ref = group.get_table(schema.table_key());
-            rbool query = rbool(internal::bridge::query(table_ref));
+            // Start from the query backing these results so that the filter only
+            // applies to their objects, e.g. the objects in a link list.
+            rbool query = rbool(m_parent.get_query());
             auto query_object = managed<T>::prepare_for_query(realm, &query);
             auto full_query = fn(query_object).q;
             return Derived(internal::bridge::results(m_parent.get_realm(), full_query));
         }
 
-        struct results_callback_wrapper : internal::bridge::collection_change_callback {
+        struct results_callback_wrapper : internal::bridge::collection_change_callback,
+                                          std::enable_shared_from_this<results_callback_wrapper> {
             explicit results_callback_wrapper(std::function<void(results_change)>&& fn,
                                               Derived *c,
-                                              bool ignore_initial_notification = true)
+                                              bool ignore_initial_notification = true,
+                                              const observe_options& options = {},
+                                              std::shared_ptr<scheduler> scheduler = nullptr)
                 : m_handler(std::move(fn)),
                   collection(c),
-                  m_ignore_changes_in_initial_notification(ignore_initial_notification) {}
+                  m_ignore_changes_in_initial_notification(ignore_initial_notification),
+                  m_throttle(options),
+                  m_scheduler(std::move(scheduler)),
+                  m_delivery_scheduler(options.delivery_scheduler) {}
 
             void before(const realm::internal::bridge::collection_change_set&) override {}
 
             void after(internal::bridge::collection_change_set const &changes) final {
                 if (m_ignore_changes_in_initial_notification) {
                     m_ignore_changes_in_initial_notification = false;
-                    m_handler({collection, {}, {}, {}});
-                } else if (changes.empty()) {
-                    m_handler({collection, {}, {}, {}});
+                    m_throttle.did_deliver();
+                    invoke_handler({collection, {}, {}, {}});
+                } else if (!m_throttle.is_enabled()) {
+                    deliver(changes);
+                } else {
+                    // Compose the change into the pending one so that the indices
+                    // stay correct when several commits are delivered at once.
+                    if (m_pending) {
+                        m_pending->merge(changes);
+                    } else {
+                        m_pending = changes;
+                    }
+                    if (m_throttle.record()) {
+                        flush();
+                    } else if (!m_throttle.flush_scheduled && m_scheduler) {
+                        m_throttle.flush_scheduled = true;
+                        m_flush_timer.invoke_after(m_scheduler, m_throttle.remaining(), [weak = this->weak_from_this()]() {
+                            if (auto self = weak.lock()) {
+                                self->m_throttle.flush_scheduled = false;
+                                self->flush();
+                            }
+                        });
+                    }
+                }
+            }
+
+            Derived *collection;
+
+        private:
+            std::function<void(results_change)> m_handler;
+            bool m_ignore_changes_in_initial_notification;
+            internal::notification_throttle m_throttle;
+            std::shared_ptr<scheduler> m_scheduler;
+            std::shared_ptr<scheduler> m_delivery_scheduler;
+            std::optional<internal::bridge::collection_change_set> m_pending;
+            internal::delayed_invoker m_flush_timer;
+
+            void flush() {
+                if (!m_throttle.has_pending() || !m_pending) {
+                    return;
+                }
+                auto changes = std::move(*m_pending);
+                m_pending.reset();
+                m_throttle.did_deliver();
+                deliver(changes);
+            }
+
+            void deliver(internal::bridge::collection_change_set const &changes) {
+                if (changes.empty()) {
+                    invoke_handler({collection, {}, {}, {}});
                 } else if (!changes.collection_root_was_deleted() || !changes.deletions().empty()) {
-                    m_handler({
+                    invoke_handler({
                             collection,
                             to_vector(changes.deletions()),
                             to_vector(changes.insertions()),
@@ -116,11 +186,21 @@ namespace realm {
                 }
             }
 
-            Derived *collection;
+            void invoke_handler(results_change&& change) {
+                if (!m_delivery_scheduler) {
+                    m_handler(std::move(change));
+                    return;
+                }
+                // The collection belongs to the observing thread and may be gone by the
+                // time the change is delivered, so it is never passed to another scheduler.
+                change.collection = nullptr;
+                m_delivery_scheduler->invoke([change = std::move(change), weak = this->weak_from_this()]() {
+                    if (auto self = weak.lock()) {
+                        self->m_handler(change);
+                    }
+                });
+            }
 
-        private:
-            std::function<void(results_change)> m_handler;
-            bool m_ignore_changes_in_initial_notification;
             std::vector<uint64_t> to_vector(const internal::bridge::index_set &index_set) {
                 auto vector = std::vector<uint64_t>();
                 for (auto index: index_set.as_indexes()) {
@@ -130,17 +210,77 @@ namespace realm {
             };
         };
 
-        realm::notification_token observe(std::function<void(results_change)>&& handler) {
-            auto r = std::make_shared<internal::bridge::results>(m_parent.get_realm(), m_parent.get_realm().table_for_object_type(managed<T>::schema.name));
-            realm::notification_token token = r->add_notification_callback(std::make_shared<results_callback_wrapper>(std::move(handler), static_cast<Derived*>(this)));
+        /**
+         Registers `handler` to be called whenever the results change. Only objects matching
+         the query are observed. Use `options` to restrict notifications to certain key paths or
+         to merge changes from consecutive commits into a single call.
+         */
+        realm::notification_token observe(std::function<void(results_change)>&& handler,
+                                          const observe_options& options = {}) {
+            auto r = std::make_shared<internal::bridge::results>(m_parent);
+            realm::notification_token token = r->add_notification_callback(
+                    std::make_shared<results_callback_wrapper>(std::move(handler), static_cast<Derived*>(this), true,
+                                                               options, r->get_realm().scheduler()),
+                    options.key_paths);
             token.m_realm = r->get_realm();
             token.m_results = r;
             return token;
         }
 
+        /**
+         Runs the query and sort order on Realm's background notification thread instead of
+         the calling thread, then calls `callback` on this Realm's scheduler with results
+         which are already evaluated, so `size()` and `operator[]` don't run the query again.
+
+         The callback is invoked once, when the scheduler delivers the next notifications
+         or the Realm is refreshed, as long as the returned token is kept. Releasing the token
+         cancels the evaluation.
+         */
+        [[nodiscard]] realm::notification_token evaluate_async(std::function<void(Derived)>&& callback) {
+            struct evaluate_callback : internal::bridge::collection_change_callback {
+                evaluate_callback(std::function<void(Derived)>&& fn, std::weak_ptr<internal::bridge::results> results)
+                    : m_fn(std::move(fn)), m_results(std::move(results)) {}
+
+                void before(const internal::bridge::collection_change_set&) override {}
+
+                void after(const internal::bridge::collection_change_set&) override {
+                    auto results = m_results.lock();
+                    if (!m_fn || !results) {
+                        return;
+                    }
+                    auto fn = std::move(m_fn);
+                    m_fn = nullptr;
+                    fn(Derived(internal::bridge::results(*results)));
+                }
+
+            private:
+                std::function<void(Derived)> m_fn;
+                // The token owns the results, so the callback doesn't keep them alive.
+                std::weak_ptr<internal::bridge::results> m_results;
+            };
+
+            auto r = std::make_shared<internal::bridge::results>(m_parent);
+            realm::notification_token token = r->add_notification_callback(
+                    std::make_shared<evaluate_callback>(std::move(callback), r));
+            token.m_realm = r->get_realm();
+            token.m_results = r;
+            return token;
+        }
+
+        /**
+         Results containing the objects which currently match, in their current order.
+         Unlike these results, the snapshot is not updated when objects are added or changed,
+         so objects can be modified or deleted while iterating over it. Deleted objects stay
+         in the snapshot as invalidated objects. Only the matching rows are captured, the
+         Realm itself is not frozen.
+         */
+        Derived snapshot() {
+            return Derived(m_parent.snapshot());
+        }
+
         Derived freeze() {
             auto frozen_realm = m_parent.get_realm().freeze();
-            return Derived(internal::bridge::results(frozen_realm, frozen_realm.table_for_object_type(managed<T>::schema.name)));
+            return Derived(m_parent.freeze(frozen_realm));
         }
 
         Derived thaw() {
@@ -160,9 +300,39 @@ namespace realm {
             return Derived(m_parent.sort(sort_descriptors));
         }
 
+        Derived distinct(const std::vector<std::string>& key_paths) {
+            return Derived(m_parent.distinct(key_paths));
+        }
+
+        /// The smallest value of `property` in these results, or `std::nullopt` if they are empty.
+        std::optional<realm::mixed> min(const std::string& property) {
+            return aggregate(m_parent.min(m_parent.get_table().get_column_key(property)));
+        }
+        /// The largest value of `property` in these results, or `std::nullopt` if they are empty.
+        std::optional<realm::mixed> max(const std::string& property) {
+            return aggregate(m_parent.max(m_parent.get_table().get_column_key(property)));
+        }
+        /// The sum of `property` over these results.
+        std::optional<realm::mixed> sum(const std::string& property) {
+            return aggregate(m_parent.sum(m_parent.get_table().get_column_key(property)));
+        }
+        /// The average of `property` over these results, or `std::nullopt` if they are empty.
+        std::optional<realm::mixed> average(const std::string& property) {
+            return aggregate(m_parent.average(m_parent.get_table().get_column_key(property)));
+        }
+
     protected:
         internal::bridge::results m_parent;
         template <auto> friend struct linking_objects;
+        template <typename> friend struct thread_safe_reference;
+
+    private:
+        static std::optional<realm::mixed> aggregate(const std::optional<internal::bridge::mixed>& value) {
+            if (!value) {
+                return std::nullopt;
+            }
+            return deserialize<realm::mixed>(*value);
+        }
     };
 
     template<typename T>
@@ -405,6 +575,65 @@ namespace realm {
         iterator end() {
             return iterator(this->m_parent.size(), static_cast<Derived*>(this));
         }
+
+        /// The number of objects handed to a thread at a time by the parallel operations.
+        static constexpr size_t parallel_chunk_size = 4096;
+
+        /**
+         Calls `fn` with every object in these results, using up to `concurrency` threads.
+
+         The results are evaluated against a frozen copy of the current version, so writes
+         made meanwhile are not seen. `fn` is called concurrently from several threads with
+         frozen objects, in no particular order, and must not write to the Realm.
+         */
+        template <typename Fn>
+        void parallel_for_each(Fn&& fn, size_t concurrency = 0) {
+            parallel_chunks(concurrency, [&fn](auto&& object, size_t) {
+                fn(std::move(object));
+            }, [](size_t) {});
+        }
+
+        /**
+         Maps every object in these results with `map` and combines the mapped values with
+         `reduce`, using up to `concurrency` threads. `identity` is the starting value.
+
+         Objects are split into fixed size chunks, each chunk is reduced in order and the
+         chunk results are then combined in order, so the result does not depend on the
+         number of threads or on how they were scheduled, even for floating point sums.
+         */
+        template <typename R, typename Map, typename Reduce>
+        R parallel_reduce(R identity, Map&& map, Reduce&& reduce, size_t concurrency = 0) {
+            // Wrapped in optional so that `std::vector<bool>` can't pack neighbouring chunks into one word.
+            std::vector<std::optional<R>> partials;
+            parallel_chunks(concurrency, [&](auto&& object, size_t chunk) {
+                partials[chunk] = reduce(std::move(*partials[chunk]), map(std::move(object)));
+            }, [&](size_t chunk_count) {
+                partials.assign(chunk_count, identity);
+            });
+            for (auto& partial : partials) {
+                identity = reduce(std::move(identity), std::move(*partial));
+            }
+            return identity;
+        }
+
+    private:
+        // Freezes the results, calls `prepare` with the number of chunks on the calling
+        // thread and then `fn(object, chunk)` for every object from the worker threads.
+        template <typename Fn, typename Prepare>
+        void parallel_chunks(size_t concurrency, Fn&& fn, Prepare&& prepare) {
+            auto frozen_realm = this->m_parent.get_realm().freeze();
+            auto frozen = this->m_parent.freeze(frozen_realm);
+            auto keys = frozen.get_keys();
+            auto table = frozen.get_table();
+            size_t chunk_count = (keys.size() + parallel_chunk_size - 1) / parallel_chunk_size;
+            prepare(chunk_count);
+            internal::parallel_for_chunks(chunk_count, concurrency, [&](size_t chunk) {
+                size_t end = std::min(keys.size(), (chunk + 1) * parallel_chunk_size);
+                for (size_t i = chunk * parallel_chunk_size; i < end; ++i) {
+                    fn(managed<T, void>(table.get_object(keys[i]), frozen_realm), chunk);
+                }
+            });
+        }
     };
 
     template<typename T>
@@ -28,6 +28,7 @@
 #include <variant>
 
 #include <type_traits>
+#include <utility>
 #include <iostream>
 
 namespace realm {
@@ -277,6 +278,36 @@ namespace realm {
                 return property_value_for_name<0>(property_name, cls, std::get<0>(properties), excluding_collections);
             }
 
+            template<size_t N>
+            variant_t property_value_at(const managed<Class, void> &cls, bool excluding_collections) const {
+                using P = std::tuple_element_t<N, std::tuple<Properties...>>;
+                const auto& property = std::get<N>(properties);
+                bool is_collection = realm::internal::bridge::property_has_flag(property.type, realm::internal::bridge::property::type::Array) ||
+                                     realm::internal::bridge::property_has_flag(property.type, realm::internal::bridge::property::type::Dictionary) ||
+                                     realm::internal::bridge::property_has_flag(property.type, realm::internal::bridge::property::type::Set);
+                if (excluding_collections && is_collection) {
+                    return variant_t{std::monostate()};
+                }
+                auto ptr = managed<Class, void>::template unmanaged_to_managed_pointer(property.ptr);
+                if constexpr (std::is_pointer_v<typename P::Result>) {
+                    return (cls.*ptr);
+                } else {
+                    return (cls.*ptr).detach();
+                }
+            }
+
+            template<size_t... Is>
+            variant_t property_value_for_index(size_t index, const managed<Class, void> &cls, bool excluding_collections, std::index_sequence<Is...>) const {
+                variant_t value;
+                static_cast<void>(((index == Is && (value = property_value_at<Is>(cls, excluding_collections), true)) || ...));
+                return value;
+            }
+
+            /// Reads the value of the property at `index` in `names` without comparing property names.
+            variant_t property_value_for_index(size_t index, const managed<Class, void> &cls, bool excluding_collections = true) const {
+                return property_value_for_index(index, cls, excluding_collections, std::index_sequence_for<Properties...>{});
+            }
+
             template<size_t N, typename T, typename P>
             constexpr const char*
             name_for_property(T ptr, P &property) const {
@@ -34,6 +34,10 @@
 #include <cpprealm/rbool.hpp>
 
 #include <cpprealm/db.hpp>
+#include <cpprealm/db_pool.hpp>
+#include <cpprealm/change_feed.hpp>
+#include <cpprealm/copy_objects.hpp>
+#include <cpprealm/expiry.hpp>
 #include <cpprealm/client_reset.hpp>
 #include <cpprealm/link.hpp>
 #include <cpprealm/macros.hpp>
@@ -51,5 +55,6 @@
 #include <cpprealm/managed_uuid.hpp>
 #include <cpprealm/observation.hpp>
 #include <cpprealm/results.hpp>
+#include <cpprealm/sharded_db.hpp>
 
 #endif /* CPPREALM_SDK_HPP */
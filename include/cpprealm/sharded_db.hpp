@@ -0,0 +1,264 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#ifndef CPPREALM_SHARDED_DB_HPP
+#define CPPREALM_SHARDED_DB_HPP
+
+#include <cpprealm/db.hpp>
+#include <cpprealm/schedulers/default_scheduler.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+namespace realm::internal {
+    /**
+     Owns a thread with its own `db` for one shard and runs the submitted functions on it,
+     in the order they were submitted.
+     */
+    struct shard_writer {
+        explicit shard_writer(db_config config);
+        shard_writer(const shard_writer&) = delete;
+        shard_writer& operator=(const shard_writer&) = delete;
+        // Runs the functions which are still queued, then closes the shard's db.
+        ~shard_writer();
+
+        std::future<void> submit(std::function<void(db&)>&& fn);
+
+    private:
+        void run(db_config config);
+
+        struct task {
+            std::function<void(db&)> fn;
+            std::promise<void> promise;
+        };
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::deque<task> m_tasks;
+        bool m_stopping = false;
+        std::thread m_thread;
+    };
+}
+
+namespace realm {
+
+    /**
+     Spreads objects over several Realm files, so that writes to different shards can be
+     committed concurrently instead of waiting for the single writer of one file.
+
+     Each shard is stored next to the configured path, e.g. `default.shard-0.realm`, and has
+     a thread which performs all writes to it. Objects are assigned to a shard by the key
+     function set with `set_shard_key`, or by the hash of their primary key. Objects added
+     together with an object, such as links, are stored in the same shard.
+
+     Reads open the shards on the calling thread and combine the results of every shard.
+     */
+    template <typename ...Ts>
+    struct sharded_db {
+        sharded_db(const db_config& config, size_t shard_count) {
+            if (shard_count == 0) {
+                throw std::invalid_argument("A sharded_db needs at least one shard.");
+            }
+            std::vector<internal::bridge::object_schema> schema;
+            (schema.push_back(managed<Ts>::schema.to_core_schema()), ...);
+            auto path = std::filesystem::path(config.path());
+            for (size_t i = 0; i < shard_count; i++) {
+                auto shard_config = config;
+                auto shard_path = path;
+                shard_path.replace_filename(path.stem().string() + ".shard-" + std::to_string(i) + path.extension().string());
+                shard_config.set_path(shard_path.string());
+                shard_config.set_schema(schema);
+                m_configs.push_back(shard_config);
+                m_writers.push_back(std::make_unique<internal::shard_writer>(std::move(shard_config)));
+            }
+        }
+
+        [[nodiscard]] size_t shard_count() const {
+            return m_configs.size();
+        }
+
+        /// Assigns objects of type `T` to shard `fn(object) % shard_count()`.
+        template <typename T>
+        void set_shard_key(std::function<size_t(const T&)>&& fn) {
+            std::get<std::function<size_t(const T&)>>(m_shard_keys) = std::move(fn);
+        }
+
+        /// The index of the shard `object` is stored in.
+        template <typename T>
+        size_t shard_for(const T& object) const {
+            if (auto& key = std::get<std::function<size_t(const T&)>>(m_shard_keys)) {
+                return key(object) % shard_count();
+            }
+            if constexpr (managed<T>::schema.HasPrimaryKeyProperty) {
+                auto primary_key = (object.*(managed<T>::schema.primary_key().ptr)).value;
+                using key_type = decltype(primary_key);
+                if constexpr (std::is_default_constructible_v<std::hash<key_type>>) {
+                    return std::hash<key_type>()(primary_key) % shard_count();
+                } else {
+                    throw std::runtime_error("Objects of this type need a shard key, see sharded_db::set_shard_key.");
+                }
+            } else {
+                throw std::runtime_error("Objects without a primary key need a shard key, see sharded_db::set_shard_key.");
+            }
+        }
+
+        /**
+         Adds `objects` to their shards. The shards are written concurrently, each in a single
+         write transaction, and this returns once all of them have committed. If a shard fails
+         to write, the first error is rethrown after the other shards have finished.
+         */
+        template <typename T>
+        void add(std::vector<T>&& objects) {
+            std::vector<std::vector<T>> batches(shard_count());
+            for (auto& object : objects) {
+                batches[shard_for(object)].push_back(std::move(object));
+            }
+            std::vector<std::future<void>> commits;
+            for (size_t i = 0; i < batches.size(); i++) {
+                if (batches[i].empty()) {
+                    continue;
+                }
+                auto batch = std::make_shared<std::vector<T>>(std::move(batches[i]));
+                commits.push_back(m_writers[i]->submit([batch](db& shard) {
+                    shard.write([&] {
+                        for (auto& object : *batch) {
+                            shard.add(std::move(object));
+                        }
+                    });
+                }));
+            }
+            wait_for(commits);
+        }
+
+        template <typename T>
+        void add(T&& object) {
+            std::vector<std::remove_cv_t<std::remove_reference_t<T>>> objects;
+            objects.push_back(std::forward<T>(object));
+            add(std::move(objects));
+        }
+
+        /**
+         Calls `fn(db&)` inside a write transaction on the thread of shard `index`.
+         The returned future becomes ready once the transaction has been committed.
+         */
+        std::future<void> write(size_t index, std::function<void(db&)>&& fn) {
+            return m_writers.at(index)->submit([fn = std::move(fn)](db& shard) {
+                shard.write([&] {
+                    fn(shard);
+                });
+            });
+        }
+
+        /// Opens shard `index` on the calling thread, at its latest version.
+        db shard(size_t index) const {
+            auto config = m_configs.at(index);
+            config.set_scheduler(default_scheduler::make_default());
+            auto shard = db(std::move(config));
+            shard.refresh();
+            return shard;
+        }
+
+        /// The objects of type `T` in every shard, one results per shard.
+        template <typename T>
+        std::vector<results<T>> objects() const {
+            std::vector<results<T>> shard_results;
+            for (size_t i = 0; i < shard_count(); i++) {
+                shard_results.push_back(shard(i).template objects<T>());
+            }
+            return shard_results;
+        }
+
+        /// The number of objects of type `T` across all shards.
+        template <typename T>
+        size_t count() const {
+            size_t count = 0;
+            for (auto& shard_results : objects<T>()) {
+                count += shard_results.size();
+            }
+            return count;
+        }
+
+        /// The smallest value of `property` across all shards, or `std::nullopt` if there are no objects.
+        template <typename T>
+        std::optional<realm::mixed> min(const std::string& property) const {
+            return combine<T>(property, [](auto& r, auto& p) { return r.min(p); }, [](auto a, auto b) { return std::min(a, b); });
+        }
+
+        /// The largest value of `property` across all shards, or `std::nullopt` if there are no objects.
+        template <typename T>
+        std::optional<realm::mixed> max(const std::string& property) const {
+            return combine<T>(property, [](auto& r, auto& p) { return r.max(p); }, [](auto a, auto b) { return std::max(a, b); });
+        }
+
+        /// The sum of `property` across all shards. Only int and double properties can be summed.
+        template <typename T>
+        std::optional<realm::mixed> sum(const std::string& property) const {
+            return combine<T>(property, [](auto& r, auto& p) { return r.sum(p); }, [](const realm::mixed& a, const realm::mixed& b) -> realm::mixed {
+                if (auto lhs = std::get_if<int64_t>(&a), rhs = std::get_if<int64_t>(&b); lhs && rhs) {
+                    return *lhs + *rhs;
+                }
+                if (auto lhs = std::get_if<double>(&a), rhs = std::get_if<double>(&b); lhs && rhs) {
+                    return *lhs + *rhs;
+                }
+                throw std::runtime_error("Only int and double properties can be summed across shards.");
+            });
+        }
+
+    private:
+        template <typename T, typename Aggregate, typename Combine>
+        std::optional<realm::mixed> combine(const std::string& property, Aggregate&& aggregate, Combine&& combine) const {
+            std::optional<realm::mixed> value;
+            for (auto& shard_results : objects<T>()) {
+                auto shard_value = aggregate(shard_results, property);
+                if (!shard_value) {
+                    continue;
+                }
+                value = value ? combine(*value, *shard_value) : *shard_value;
+            }
+            return value;
+        }
+
+        static void wait_for(std::vector<std::future<void>>& futures) {
+            std::exception_ptr error;
+            for (auto& future : futures) {
+                try {
+                    future.get();
+                } catch (...) {
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+            }
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        std::vector<db_config> m_configs;
+        std::vector<std::unique_ptr<internal::shard_writer>> m_writers;
+        std::tuple<std::function<size_t(const Ts&)>...> m_shard_keys;
+    };
+}
+
+#endif //CPPREALM_SHARDED_DB_HPP
@@ -19,9 +19,21 @@
 #ifndef CPPREALM_THREAD_SAFE_REFERENCE_HPP
 #define CPPREALM_THREAD_SAFE_REFERENCE_HPP
 
+#include <cpprealm/internal/bridge/dictionary.hpp>
+#include <cpprealm/internal/bridge/list.hpp>
+#include <cpprealm/internal/bridge/object.hpp>
+#include <cpprealm/internal/bridge/results.hpp>
+#include <cpprealm/internal/bridge/set.hpp>
 #include <cpprealm/internal/bridge/thread_safe_reference.hpp>
 
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
 namespace realm {
+    template <typename>
+    struct results;
 
     template <typename T>
     struct thread_safe_reference {
@@ -31,6 +43,47 @@ namespace realm {
         internal::bridge::thread_safe_reference m_tsr;
         friend struct db;
     };
+
+    /// Hands results to another thread. Resolving it with `db::resolve` on the other thread
+    /// yields the same results without evaluating the query again from scratch.
+    template <typename T>
+    struct thread_safe_reference<results<T>> {
+        explicit thread_safe_reference(const results<T>& results)
+            : m_tsr(internal::bridge::thread_safe_reference(results.m_parent)) { }
+    private:
+        internal::bridge::thread_safe_reference m_tsr;
+        friend struct db;
+    };
+
+    /// Hands a managed list to another thread, where `db::resolve` returns it as `results`.
+    template <typename T>
+    struct thread_safe_reference<std::vector<T>> {
+        explicit thread_safe_reference(const managed<std::vector<T>>& list)
+            : m_tsr(internal::bridge::thread_safe_reference(internal::bridge::list(*list.m_realm, *list.m_obj, list.m_key))) { }
+    private:
+        internal::bridge::thread_safe_reference m_tsr;
+        friend struct db;
+    };
+
+    /// Hands a managed set to another thread, where `db::resolve` returns it as `results`.
+    template <typename T>
+    struct thread_safe_reference<std::set<T>> {
+        explicit thread_safe_reference(const managed<std::set<T>>& set)
+            : m_tsr(internal::bridge::thread_safe_reference(internal::bridge::set(*set.m_realm, *set.m_obj, set.m_key))) { }
+    private:
+        internal::bridge::thread_safe_reference m_tsr;
+        friend struct db;
+    };
+
+    /// Hands a managed map to another thread, where `db::resolve` returns its contents.
+    template <typename T>
+    struct thread_safe_reference<std::map<std::string, T>> {
+        explicit thread_safe_reference(const managed<std::map<std::string, T>>& map)
+            : m_tsr(internal::bridge::thread_safe_reference(internal::bridge::object(*map.m_realm, *map.m_obj).get_dictionary(map.m_key))) { }
+    private:
+        internal::bridge::thread_safe_reference m_tsr;
+        friend struct db;
+    };
 }
 
 #endif /* CPPREALM_THREAD_SAFE_REFERENCE_HPP */
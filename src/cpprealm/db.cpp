@@ -6,6 +6,43 @@ namespace realm {
         return ::realm::sync_subscription_set(m_realm);
     }
 
+    std::optional<uint64_t> db::write_copy(const std::string& path, const write_copy_options& options) {
+        auto frozen = m_realm.freeze();
+        auto version = frozen.read_transaction_version();
+        if (options.unchanged_since && *options.unchanged_since == version) {
+            return std::nullopt;
+        }
+        frozen.write_copy(path, options.encryption_key);
+        return version;
+    }
+
+    bool db::compact() {
+        if (m_realm.is_frozen() || m_realm.is_in_transaction()) {
+            return false;
+        }
+        return m_realm.compact();
+    }
+
+    bool db::compact_if_needed(const compaction_policy& policy) {
+        if (m_realm.is_frozen() || m_realm.is_in_transaction()) {
+            return false;
+        }
+        auto stats = m_realm.file_stats();
+        if (stats.total_bytes == 0 || stats.total_bytes < policy.min_file_size) {
+            return false;
+        }
+        if (static_cast<double>(stats.free_bytes) / static_cast<double>(stats.total_bytes) < policy.min_free_ratio) {
+            return false;
+        }
+        // The file keeps more than one version even with a single reader, so pinned versions
+        // are left to `compact()`, which fails without exclusive access to the file.
+        return m_realm.compact();
+    }
+
+    db_file_stats db::file_stats() const {
+        return m_realm.file_stats();
+    }
+
     bool db::is_frozen() const {
         return m_realm.is_frozen();
     }
@@ -0,0 +1,134 @@
+#include <cpprealm/db_pool.hpp>
+
+#include <cpprealm/schedulers/default_scheduler.hpp>
+
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace realm {
+    namespace {
+        struct pooled_db {
+            // The config passed to `get`, without this thread's scheduler.
+            db_config config;
+            db realm;
+            std::chrono::steady_clock::time_point last_used;
+        };
+
+        // The instances opened on this thread, by pool and path. Keeping them thread local
+        // means they are always released on the thread which opened them. A path has several
+        // entries when it was opened with different schemas.
+        using thread_pool = std::unordered_multimap<std::string, pooled_db>;
+        thread_local std::unordered_map<uint64_t, thread_pool> t_pools;
+
+        // The ids of the pools which haven't been destroyed yet. A pool can only release the
+        // instances of the thread destroying it, the other threads release theirs on their
+        // next `get` once the generation has changed.
+        struct pool_registry {
+            std::mutex mutex;
+            std::unordered_set<uint64_t> live_ids;
+            uint64_t next_id = 0;
+            std::atomic<uint64_t> generation{0};
+        };
+
+        pool_registry& get_pool_registry() {
+            static pool_registry registry;
+            return registry;
+        }
+
+        thread_local uint64_t t_swept_generation = 0;
+
+        void release_destroyed_pools() {
+            auto& registry = get_pool_registry();
+            if (registry.generation.load() == t_swept_generation) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (auto it = t_pools.begin(); it != t_pools.end();) {
+                if (registry.live_ids.count(it->first) == 0) {
+                    it = t_pools.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            t_swept_generation = registry.generation.load();
+        }
+
+        uint64_t register_pool() {
+            auto& registry = get_pool_registry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            auto id = ++registry.next_id;
+            registry.live_ids.insert(id);
+            return id;
+        }
+
+        void unregister_pool(uint64_t id) {
+            auto& registry = get_pool_registry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.live_ids.erase(id);
+            ++registry.generation;
+        }
+    }
+
+    db_pool::db_pool(std::chrono::milliseconds idle_timeout)
+        : m_id(register_pool()), m_idle_timeout(idle_timeout) {
+    }
+
+    db_pool::~db_pool() {
+        clear();
+        unregister_pool(m_id);
+    }
+
+    db db_pool::get(const db_config& config) {
+        release_destroyed_pools();
+        evict_idle();
+        auto& pool = t_pools[m_id];
+        auto path = config.path();
+        auto now = std::chrono::steady_clock::now();
+        auto [begin, end] = pool.equal_range(path);
+        for (auto it = begin; it != end;) {
+            if (it->second.realm.is_closed()) {
+                it = pool.erase(it);
+            } else if (!it->second.config.opens_same_realm(config)) {
+                ++it;
+            } else {
+                ++m_hits;
+                it->second.last_used = now;
+                it->second.realm.refresh();
+                return it->second.realm;
+            }
+        }
+
+        ++m_misses;
+        auto thread_config = config;
+        thread_config.set_scheduler(default_scheduler::make_default());
+        auto realm = db(std::move(thread_config));
+        pool.emplace(path, pooled_db{config, realm, now});
+        return realm;
+    }
+
+    void db_pool::evict_idle() {
+        auto it = t_pools.find(m_id);
+        if (it == t_pools.end()) {
+            return;
+        }
+        auto cutoff = std::chrono::steady_clock::now() - m_idle_timeout;
+        auto& pool = it->second;
+        for (auto entry = pool.begin(); entry != pool.end();) {
+            if (entry->second.last_used < cutoff) {
+                entry = pool.erase(entry);
+                ++m_evictions;
+            } else {
+                ++entry;
+            }
+        }
+    }
+
+    void db_pool::clear() {
+        t_pools.erase(m_id);
+    }
+
+    db_pool_stats db_pool::stats() const {
+        return {m_hits, m_misses, m_evictions};
+    }
+} // namespace realm
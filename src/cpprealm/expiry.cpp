@@ -0,0 +1,114 @@
+#include <cpprealm/expiry.hpp>
+
+#include <cpprealm/internal/scheduler/realm_core_scheduler.hpp>
+
+#include <realm/object-store/util/scheduler.hpp>
+
+namespace realm {
+    expiry_sweeper::expiry_sweeper(const db_config& config, std::chrono::milliseconds interval, size_t batch_size)
+        : m_interval(interval), m_batch_size(batch_size) {
+        if (batch_size == 0) {
+            throw std::invalid_argument("The batch size of an expiry_sweeper must not be zero.");
+        }
+        m_thread = std::thread([this, config]() mutable {
+            run(std::move(config));
+        });
+    }
+
+    expiry_sweeper::~expiry_sweeper() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_condition.notify_all();
+        m_thread.join();
+    }
+
+    void expiry_sweeper::add_rule(rule&& r) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_rules.push_back(std::move(r));
+    }
+
+    void expiry_sweeper::sweep() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto target = ++m_requested_sweeps;
+        m_condition.notify_all();
+        m_condition.wait(lock, [&] { return m_stopping || m_completed_sweeps >= target; });
+    }
+
+    expiry_stats expiry_sweeper::stats() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stats;
+    }
+
+    void expiry_sweeper::run(db_config config) {
+        // The config was created on another thread, so it needs a scheduler for this one.
+        config.set_scheduler(std::make_shared<internal::realm_core_scheduler>(util::Scheduler::make_generic()));
+        std::optional<db> realm;
+        try {
+            realm.emplace(std::move(config));
+        } catch (...) {
+            // Without a Realm no sweep can succeed, so every request fails right away.
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_condition.wait_for(lock, m_interval, [this] {
+                return m_stopping || m_requested_sweeps > m_completed_sweeps;
+            });
+            if (m_stopping) {
+                break;
+            }
+            auto target = m_requested_sweeps;
+            lock.unlock();
+            if (realm) {
+                run_sweep(*realm);
+            } else {
+                std::lock_guard<std::mutex> stats_lock(m_mutex);
+                m_stats.failed_sweeps++;
+            }
+            lock.lock();
+            m_completed_sweeps = target;
+            m_condition.notify_all();
+        }
+    }
+
+    void expiry_sweeper::run_sweep(db& realm) {
+        std::vector<rule> rules;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            rules = m_rules;
+        }
+        auto start = std::chrono::steady_clock::now();
+        uint64_t deleted = 0;
+        bool failed = false;
+        try {
+            for (auto& rule : rules) {
+                while (true) {
+                    // Each batch is its own transaction, so other writers can get in between.
+                    write_transaction transaction(realm);
+                    auto removed = rule(realm, m_batch_size);
+                    if (removed == 0) {
+                        transaction.cancel();
+                        break;
+                    }
+                    transaction.commit();
+                    deleted += removed;
+                }
+            }
+        } catch (...) {
+            failed = true;
+        }
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (failed) {
+            m_stats.failed_sweeps++;
+        } else {
+            m_stats.sweeps++;
+        }
+        m_stats.deleted_objects += deleted;
+        m_stats.last_sweep_duration = duration;
+        m_stats.max_sweep_duration = std::max(m_stats.max_sweep_duration, duration);
+    }
+} // namespace realm
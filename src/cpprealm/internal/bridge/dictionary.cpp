@@ -106,10 +106,21 @@ namespace realm::internal::bridge {
         return get_dictionary()->get(key);
     }
 
+    std::optional<mixed> core_dictionary::try_get(const std::string& key) const {
+        if (auto v = get_dictionary()->try_get(key)) {
+            return mixed(*v);
+        }
+        return std::nullopt;
+    }
+
     void core_dictionary::erase(const std::string& key) {
         get_dictionary()->erase(key);
     }
 
+    bool core_dictionary::try_erase(const std::string& key) {
+        return get_dictionary()->try_erase(key);
+    }
+
     obj core_dictionary::get_object(const std::string& key) {
         return get_dictionary()->get_object(key);
     }
@@ -122,6 +133,11 @@ namespace realm::internal::bridge {
         return get_dictionary()->get_pair(ndx);
     }
 
+    std::string_view core_dictionary::get_key(size_t ndx) const {
+        StringData key = get_dictionary()->get_key(ndx).get_string();
+        return std::string_view(key.data(), key.size());
+    }
+
     size_t core_dictionary::find_any_key(const std::string& value) const noexcept {
         return get_dictionary()->find_any_key(value);
     }
@@ -3,6 +3,7 @@
 #include <cpprealm/internal/bridge/col_key.hpp>
 #include <cpprealm/internal/bridge/mixed.hpp>
 #include <cpprealm/internal/bridge/obj.hpp>
+#include <cpprealm/internal/bridge/query.hpp>
 #include <cpprealm/internal/bridge/results.hpp>
 #include <cpprealm/internal/bridge/table.hpp>
 
@@ -134,6 +135,10 @@ namespace realm::internal::bridge {
         return get_list()->as_results();
     }
 
+    query list::get_query() const {
+        return get_list()->get_query();
+    }
+
     table list::get_table() const {
         return get_list()->get_table();
     }
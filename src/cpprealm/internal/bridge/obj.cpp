@@ -201,6 +201,9 @@ namespace realm::internal::bridge {
     void obj::set(const col_key &col_key, const int64_t &value) {
         get_obj()->set<Int>(col_key, value);
     }
+    void obj::add_int(const col_key &col_key, int64_t value) {
+        get_obj()->add_int(col_key, value);
+    }
     void obj::set(const col_key &col_key, const bool &value) {
         get_obj()->set<Bool>(col_key, value);
     }
@@ -393,6 +396,10 @@ namespace realm::internal::bridge {
         get_obj()->set_null(v);
     }
 
+    void obj::clear_collection(const col_key &v) {
+        get_obj()->get_collection_ptr(v)->clear();
+    }
+
     table group::get_table(const std::string &table_key) {
         return static_cast<SharedRealm>(m_realm.get())->read_group().get_table(table_name_for_object_type(table_key));
     }
@@ -20,6 +20,10 @@ namespace realm::internal::bridge {
         return ObjKey(m_obj_key);
     }
 
+    int64_t obj_key::value() const {
+        return m_obj_key;
+    }
+
     bool operator==(obj_key const& lhs, obj_key const& rhs) {
         return lhs.operator ObjKey() == rhs.operator ObjKey();
     }
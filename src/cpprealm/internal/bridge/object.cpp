@@ -10,6 +10,8 @@
 #include <realm/object-store/dictionary.hpp>
 #include <realm/object-store/list.hpp>
 #include <realm/object-store/object.hpp>
+#include <realm/object-store/shared_realm.hpp>
+#include <realm/object-store/impl/collection_change_builder.hpp>
 
 namespace realm::internal::bridge {
     object::object() {
@@ -126,7 +128,8 @@ namespace realm::internal::bridge {
         return *m_object;
 #endif
     }
-    notification_token object::add_notification_callback(std::shared_ptr<collection_change_callback>&& cb) {
+    notification_token object::add_notification_callback(std::shared_ptr<collection_change_callback>&& cb,
+                                                          const std::vector<std::string>& key_paths) {
         struct wrapper : CollectionChangeCallback {
             std::shared_ptr<collection_change_callback> m_cb;
             explicit wrapper(std::shared_ptr<collection_change_callback>&& cb)
@@ -139,10 +142,14 @@ namespace realm::internal::bridge {
             }
         } ccb(std::move(cb));
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
-        return reinterpret_cast<Object*>(&m_object)->add_notification_callback(ccb);
+        auto& object = *reinterpret_cast<Object*>(&m_object);
 #else
-        return m_object->add_notification_callback(ccb);
+        auto& object = *m_object;
 #endif
+        if (key_paths.empty()) {
+            return object.add_notification_callback(ccb);
+        }
+        return object.add_notification_callback(ccb, object.get_realm()->create_key_path_array(object.get_object_schema().name, key_paths));
     }
 
     bool index_set::empty() const {
@@ -246,6 +253,22 @@ namespace realm::internal::bridge {
         return map;
     }
 
+    std::vector<int64_t> collection_change_set::column_keys() const {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        auto& columns = reinterpret_cast<const CollectionChangeSet *>(&m_change_set)->columns;
+#else
+        auto& columns = m_change_set->columns;
+#endif
+        std::vector<int64_t> keys;
+        keys.reserve(columns.size());
+        for (const auto &[k, v]: columns) {
+            if (!v.empty()) {
+                keys.push_back(k);
+            }
+        }
+        return keys;
+    }
+
     index_set collection_change_set::deletions() const {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         return reinterpret_cast<const CollectionChangeSet *>(&m_change_set)->deletions;
@@ -449,6 +472,19 @@ namespace realm::internal::bridge {
 #endif
     }
 
+    void collection_change_set::merge(const collection_change_set& next) {
+        auto to_builder = [](const CollectionChangeSet& c) {
+            // The builder tracks modifications by their index in the new collection.
+            _impl::CollectionChangeBuilder builder(c.deletions, c.insertions, c.modifications_new,
+                                                   c.moves, c.collection_root_was_deleted);
+            builder.columns = c.columns;
+            return builder;
+        };
+        auto builder = to_builder(static_cast<CollectionChangeSet>(*this));
+        builder.merge(to_builder(static_cast<CollectionChangeSet>(next)));
+        *this = collection_change_set(std::move(builder).finalize());
+    }
+
     bool index_set::index_iterator::operator!=(const index_set::index_iterator &it) const noexcept {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         return reinterpret_cast<const IndexSet::IndexIterator*>(&m_iterator)->operator!=(
@@ -5,10 +5,13 @@
 #include <cpprealm/logger.hpp>
 #include <cpprealm/internal/bridge/async_open_task.hpp>
 #include <cpprealm/internal/bridge/dictionary.hpp>
+#include <cpprealm/internal/bridge/list.hpp>
 #include <cpprealm/internal/bridge/obj.hpp>
 #include <cpprealm/internal/bridge/object.hpp>
 #include <cpprealm/internal/bridge/object_schema.hpp>
+#include <cpprealm/internal/bridge/results.hpp>
 #include <cpprealm/internal/bridge/schema.hpp>
+#include <cpprealm/internal/bridge/set.hpp>
 #include <cpprealm/internal/bridge/sync_error.hpp>
 #include <cpprealm/internal/bridge/sync_session.hpp>
 #include <cpprealm/internal/bridge/table.hpp>
@@ -16,7 +19,12 @@
 #include <cpprealm/internal/scheduler/realm_core_scheduler.hpp>
 #include <cpprealm/schedulers/default_scheduler.hpp>
 
+#include <realm/db.hpp>
+#include <realm/exceptions.hpp>
 #include <realm/object-store/dictionary.hpp>
+#include <realm/object-store/list.hpp>
+#include <realm/object-store/results.hpp>
+#include <realm/object-store/set.hpp>
 #include <realm/object-store/object_store.hpp>
 
 #include <realm/object-store/schema.hpp>
@@ -26,6 +34,9 @@
 #include <realm/object-store/thread_safe_reference.hpp>
 #include <realm/object-store/util/scheduler.hpp>
 #include <realm/sync/config.hpp>
+#include <realm/util/disable_sync_to_disk.hpp>
+
+#include <mutex>
 
 #if defined(REALM_AOSP_VENDOR)
 #include <unistd.h>
@@ -48,6 +59,18 @@ namespace realm::internal::bridge {
     static_assert((uint8_t)client_reset_mode::recover == (uint8_t)::realm::ClientResyncMode::Recover);
     static_assert((uint8_t)client_reset_mode::recover_or_discard == (uint8_t)::realm::ClientResyncMode::RecoverOrDiscard);
 
+    namespace {
+        // Whether a Realm opened with `a` can be handed to a user of `b`, i.e. the two
+        // configurations see the same schema and can read the same file.
+        bool has_same_schema_and_key(const RealmConfig& a, const RealmConfig& b) {
+            return a.schema == b.schema
+                && a.schema_mode == b.schema_mode
+                && a.schema_version == b.schema_version
+                && a.encryption_key == b.encryption_key
+                && a.in_memory == b.in_memory;
+        }
+    }
+
     class null_logger : public ::realm::logger {
     public:
         null_logger() {
@@ -60,14 +83,22 @@ namespace realm::internal::bridge {
     : m_realm(std::move(v)){}
 
     realm::operator std::shared_ptr<Realm>() const {
-        return m_realm;
+        return shared_realm();
     }
     void realm::begin_transaction() const {
-        m_realm->begin_transaction();
+        shared_realm()->begin_transaction();
     }
 
     void realm::commit_transaction() const {
-        m_realm->commit_transaction();
+        shared_realm()->commit_transaction();
+    }
+
+    void realm::cancel_transaction() const {
+        shared_realm()->cancel_transaction();
+    }
+
+    bool realm::is_in_transaction() const {
+        return shared_realm()->is_in_transaction();
     }
 
     realm::realm(thread_safe_reference&& tsr, const std::optional<std::shared_ptr<struct scheduler>>& s) {
@@ -191,7 +222,7 @@ namespace realm::internal::bridge {
         return get_config()->path;
     }
     realm::config realm::get_config() const {
-        return m_realm->config();
+        return shared_realm()->config();
     }
     void realm::config::set_schema(const std::vector<object_schema> &v) {
         std::vector<ObjectSchema> v2;
@@ -212,7 +243,7 @@ namespace realm::internal::bridge {
     }
 
     schema realm::schema() const {
-        return m_realm->schema();
+        return shared_realm()->schema();
     }
 
     table realm::table_for_object_type(const std::string &object_type) {
@@ -239,10 +270,10 @@ namespace realm::internal::bridge {
         m_realm = Realm::get_shared_realm(static_cast<RealmConfig>(v));
     }
     bool operator==(realm const &lhs, realm const &rhs) {
-        return static_cast<SharedRealm>(lhs) == static_cast<SharedRealm>(rhs);
+        return lhs.m_realm == rhs.m_realm;
     }
     bool operator!=(realm const& lhs, realm const& rhs) {
-        return static_cast<SharedRealm>(lhs) != static_cast<SharedRealm>(rhs);
+        return lhs.m_realm != rhs.m_realm;
     }
     template <>
     dictionary resolve(const realm& r, thread_safe_reference &&tsr) {
@@ -258,6 +289,30 @@ namespace realm::internal::bridge {
         return reinterpret_cast<ThreadSafeReference*>(tsr.m_thread_safe_reference)->resolve<Object>(r);
 #else
         return reinterpret_cast<ThreadSafeReference*>(tsr.m_thread_safe_reference.get())->resolve<Object>(r);
+#endif
+    }
+    template <>
+    list resolve(const realm& r, thread_safe_reference &&tsr) {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return reinterpret_cast<ThreadSafeReference*>(tsr.m_thread_safe_reference)->resolve<List>(r);
+#else
+        return reinterpret_cast<ThreadSafeReference*>(tsr.m_thread_safe_reference.get())->resolve<List>(r);
+#endif
+    }
+    template <>
+    results resolve(const realm& r, thread_safe_reference &&tsr) {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return reinterpret_cast<ThreadSafeReference*>(tsr.m_thread_safe_reference)->resolve<Results>(r);
+#else
+        return reinterpret_cast<ThreadSafeReference*>(tsr.m_thread_safe_reference.get())->resolve<Results>(r);
+#endif
+    }
+    template <>
+    set resolve(const realm& r, thread_safe_reference &&tsr) {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return reinterpret_cast<ThreadSafeReference*>(tsr.m_thread_safe_reference)->resolve<object_store::Set>(r);
+#else
+        return reinterpret_cast<ThreadSafeReference*>(tsr.m_thread_safe_reference.get())->resolve<object_store::Set>(r);
 #endif
     }
     void realm::config::set_scheduler(const std::shared_ptr<struct scheduler> &s) {
@@ -309,6 +364,27 @@ namespace realm::internal::bridge {
         get_config()->should_compact_on_launch_function = std::move(fn);
     }
 
+    void realm::config::set_in_memory(bool in_memory) {
+        get_config()->in_memory = in_memory;
+    }
+
+    bool realm::config::in_memory() const {
+        return get_config()->in_memory;
+    }
+
+    void realm::config::set_max_number_of_active_versions(uint64_t max) {
+        get_config()->max_number_of_active_versions = max;
+    }
+
+    uint64_t realm::config::max_number_of_active_versions() const {
+        return get_config()->max_number_of_active_versions;
+    }
+
+    bool realm::config::opens_same_realm(const config& other) const {
+        return get_config()->path == other.get_config()->path
+            && has_same_schema_and_key(*get_config(), *other.get_config());
+    }
+
     void realm::config::enable_forced_sync_history() {
         get_config()->force_sync_history = true;
     }
@@ -342,7 +418,7 @@ namespace realm::internal::bridge {
     }
 
     struct std::shared_ptr<scheduler> realm::scheduler() const {
-        return std::make_shared<realm_core_scheduler>(realm_core_scheduler(m_realm->scheduler()));
+        return std::make_shared<realm_core_scheduler>(realm_core_scheduler(shared_realm()->scheduler()));
     }
 
     async_open_task realm::get_synchronized_realm(const config &c) {
@@ -369,60 +445,202 @@ namespace realm::internal::bridge {
     }
 
     bool realm::refresh() {
-        return m_realm->refresh();
+        return shared_realm()->refresh();
+    }
+
+    bool realm::compact() {
+        return shared_realm()->compact();
+    }
+
+    file_stats realm::file_stats() const {
+        struct file_stats stats;
+        auto& db = Realm::Internal::get_db(*shared_realm());
+        size_t free_space = 0;
+        size_t used_space = 0;
+        db->get_stats(free_space, used_space);
+        stats.free_bytes = free_space;
+        stats.used_bytes = used_space;
+        stats.total_bytes = free_space + used_space;
+        stats.live_versions = db->get_number_of_versions();
+        auto& group = shared_realm()->read_group();
+        for (auto key : group.get_table_keys()) {
+            auto object_type = ObjectStore::object_type_for_table_name(group.get_table_name(key));
+            if (!object_type.empty()) {
+                stats.objects_per_type[std::string(object_type)] = group.get_table(key)->size();
+            }
+        }
+        return stats;
+    }
+
+    void realm::write_copy(const std::string& path, const std::optional<std::array<char, 64>>& encryption_key) const {
+        auto config = shared_realm()->config();
+        config.path = path;
+        config.encryption_key.clear();
+        if (encryption_key) {
+            config.encryption_key.assign(encryption_key->begin(), encryption_key->end());
+        }
+        config.sync_config = nullptr;
+        shared_realm()->convert(config, false);
+    }
+
+    uint64_t realm::read_transaction_version() const {
+        return shared_realm()->read_transaction_version().version;
+    }
+
+    bool realm::auto_refresh() const {
+        return shared_realm()->auto_refresh();
+    }
+
+    void realm::set_auto_refresh(bool auto_refresh) {
+        shared_realm()->set_auto_refresh(auto_refresh);
     }
 
     bool realm::is_frozen() const {
-        return m_realm->is_frozen();
+        return shared_realm()->is_frozen();
+    }
+
+    namespace {
+        // Frozen Realms can be used from any thread, so one instance per file, version
+        // and configuration is shared by everyone who freezes that version. Entries don't
+        // keep the Realm alive, the version is unpinned once the last user releases it.
+        struct frozen_realm_cache {
+            struct entry {
+                std::weak_ptr<Realm> realm;
+                std::chrono::steady_clock::time_point frozen_at;
+            };
+            std::mutex mutex;
+            // Several entries for a path and version exist when it was frozen with different configurations.
+            std::multimap<std::pair<std::string, uint64_t>, entry> realms;
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+
+            void remove_expired() {
+                for (auto it = realms.begin(); it != realms.end();) {
+                    if (it->second.realm.expired()) {
+                        it = realms.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+            }
+        };
+
+        frozen_realm_cache& get_frozen_realm_cache() {
+            static frozen_realm_cache cache;
+            return cache;
+        }
     }
 
     realm realm::freeze() {
-        m_realm->verify_thread();
+        shared_realm()->verify_thread();
         if (is_frozen())
             return *this;
+        auto key = std::make_pair(shared_realm()->config().path, shared_realm()->read_transaction_version().version);
+        auto& cache = get_frozen_realm_cache();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        auto [begin, end] = cache.realms.equal_range(key);
+        for (auto it = begin; it != end; ++it) {
+            auto frozen = it->second.realm.lock();
+            if (frozen && !frozen->is_closed() && has_same_schema_and_key(frozen->config(), shared_realm()->config())) {
+                ++cache.hits;
+                return frozen;
+            }
+        }
+        ++cache.misses;
+        cache.remove_expired();
         realm realm;
-        realm.m_realm = m_realm->freeze();
-        realm.m_realm->read_group();
+        realm.m_realm = shared_realm()->freeze();
+        realm.shared_realm()->read_group();
+        cache.realms.emplace(key, frozen_realm_cache::entry{realm.m_realm, std::chrono::steady_clock::now()});
         return realm;
     }
 
+    frozen_realm_stats get_frozen_realm_stats() {
+        auto& cache = get_frozen_realm_cache();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        cache.remove_expired();
+        frozen_realm_stats stats;
+        for (auto& [key, realm] : cache.realms) {
+            auto& versions = stats.pinned_versions[key.first];
+            // Entries are ordered by version, so a version frozen with several configurations is adjacent.
+            if (versions.empty() || versions.back() != key.second) {
+                versions.push_back(key.second);
+            }
+        }
+        stats.hits = cache.hits;
+        stats.misses = cache.misses;
+        return stats;
+    }
+
+    void disable_sync_to_disk(bool disable) {
+        ::realm::disable_sync_to_disk(disable);
+    }
+
+    std::vector<frozen_version> get_frozen_versions() {
+        auto& cache = get_frozen_realm_cache();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        cache.remove_expired();
+        auto now = std::chrono::steady_clock::now();
+        std::vector<frozen_version> versions;
+        for (auto& [key, entry] : cache.realms) {
+            versions.push_back({key.first, key.second, now - entry.frozen_at, entry.realm.use_count()});
+        }
+        return versions;
+    }
+
     realm realm::thaw() {
-        m_realm->verify_thread();
+        shared_realm()->verify_thread();
         if (!is_frozen())
             return *this;
-        auto config = m_realm->config();
+        auto config = shared_realm()->config();
         config.cache = true;
         config.scheduler = create_scheduler_shim(default_scheduler::make_default());
         return realm(std::move(config));
     }
 
     void realm::close() {
+        if (!m_realm) {
+            return;
+        }
+        if (m_realm->is_frozen()) {
+            // Frozen Realms are shared by everyone who froze the same version, see
+            // `realm::freeze()`, so only this handle lets go of it.
+            m_realm.reset();
+            return;
+        }
         m_realm->close();
     }
 
     bool realm::is_closed() {
-        return m_realm->is_closed();
+        return !m_realm || m_realm->is_closed();
+    }
+
+    const std::shared_ptr<Realm>& realm::shared_realm() const {
+        if (!m_realm) {
+            throw LogicError(ErrorCodes::ClosedRealm, "Cannot access realm that has been closed.");
+        }
+        return m_realm;
     }
 
     void realm::invalidate() {
-        m_realm->verify_thread();
-        m_realm->invalidate();
+        shared_realm()->verify_thread();
+        shared_realm()->invalidate();
     }
 
     obj realm::import_copy_of(const obj& o) const {
-        return m_realm->import_copy_of(o.operator Obj());
+        return shared_realm()->import_copy_of(o.operator Obj());
     }
 
     [[nodiscard]] std::optional<sync_session> realm::get_sync_session() const {
-        auto& config = m_realm->config().sync_config;
+        auto& config = shared_realm()->config().sync_config;
         if (!config) {
             return std::nullopt;
         }
 
-        return sync_session(m_realm->sync_session());
+        return sync_session(shared_realm()->sync_session());
     }
 
     table realm::get_table(const uint32_t &key) {
-        return m_realm->read_group().get_table(TableKey(key));
+        return shared_realm()->read_group().get_table(TableKey(key));
     }
 }
@@ -5,6 +5,7 @@
 #include <cpprealm/internal/bridge/realm.hpp>
 #include <cpprealm/internal/bridge/table.hpp>
 #include <realm/object-store/results.hpp>
+#include <realm/object-store/shared_realm.hpp>
 
 namespace realm::internal::bridge {
     sort_descriptor::operator std::pair<std::string, bool>() const {
@@ -79,6 +80,14 @@ namespace realm::internal::bridge {
 #endif
     }
 
+    results::operator Results() const {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return *reinterpret_cast<const Results*>(&m_results);
+#else
+        return *m_results;
+#endif
+    }
+
     size_t results::size() {
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
         return reinterpret_cast<Results*>(&m_results)->size();
@@ -217,7 +226,102 @@ namespace realm::internal::bridge {
 #endif
     }
 
-    notification_token results::add_notification_callback(std::shared_ptr<collection_change_callback> &&cb) {
+    results results::distinct(const std::vector<std::string>& key_paths) {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return reinterpret_cast<Results*>(&m_results)->distinct(key_paths);
+#else
+        return m_results->distinct(key_paths);
+#endif
+    }
+
+    query results::get_query() const {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return reinterpret_cast<const Results*>(&m_results)->get_query();
+#else
+        return m_results->get_query();
+#endif
+    }
+
+    std::optional<mixed> results::min(const col_key& column) {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        auto value = reinterpret_cast<Results*>(&m_results)->min(column);
+#else
+        auto value = m_results->min(column);
+#endif
+        if (!value || value->is_null()) {
+            return std::nullopt;
+        }
+        return mixed(*value);
+    }
+
+    std::optional<mixed> results::max(const col_key& column) {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        auto value = reinterpret_cast<Results*>(&m_results)->max(column);
+#else
+        auto value = m_results->max(column);
+#endif
+        if (!value || value->is_null()) {
+            return std::nullopt;
+        }
+        return mixed(*value);
+    }
+
+    std::optional<mixed> results::sum(const col_key& column) {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        auto value = reinterpret_cast<Results*>(&m_results)->sum(column);
+#else
+        auto value = m_results->sum(column);
+#endif
+        if (!value || value->is_null()) {
+            return std::nullopt;
+        }
+        return mixed(*value);
+    }
+
+    std::optional<mixed> results::average(const col_key& column) {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        auto value = reinterpret_cast<Results*>(&m_results)->average(column);
+#else
+        auto value = m_results->average(column);
+#endif
+        if (!value || value->is_null()) {
+            return std::nullopt;
+        }
+        return mixed(*value);
+    }
+
+    results results::snapshot() const {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return reinterpret_cast<const Results*>(&m_results)->snapshot();
+#else
+        return m_results->snapshot();
+#endif
+    }
+
+    results results::freeze(const realm& frozen_realm) const {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        return reinterpret_cast<const Results*>(&m_results)->freeze(frozen_realm);
+#else
+        return m_results->freeze(frozen_realm);
+#endif
+    }
+
+    std::vector<obj_key> results::get_keys() {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        auto tv = reinterpret_cast<Results*>(&m_results)->get_tableview();
+#else
+        auto tv = m_results->get_tableview();
+#endif
+        std::vector<obj_key> keys;
+        keys.reserve(tv.size());
+        for (size_t i = 0; i < tv.size(); ++i) {
+            keys.emplace_back(tv.get_key(i));
+        }
+        return keys;
+    }
+
+    notification_token results::add_notification_callback(std::shared_ptr<collection_change_callback> &&cb,
+                                                           const std::vector<std::string>& key_paths) {
         struct wrapper : CollectionChangeCallback {
             std::shared_ptr<collection_change_callback> m_cb;
             explicit wrapper(std::shared_ptr<collection_change_callback>&& cb)
@@ -230,10 +334,14 @@ namespace realm::internal::bridge {
             }
         } ccb(std::move(cb));
 #ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
-        return reinterpret_cast<Results*>(&m_results)->add_notification_callback(ccb);
+        auto& results = *reinterpret_cast<Results*>(&m_results);
 #else
-        return m_results->add_notification_callback(ccb);
+        auto& results = *m_results;
 #endif
+        if (key_paths.empty()) {
+            return results.add_notification_callback(ccb);
+        }
+        return results.add_notification_callback(ccb, results.get_realm()->create_key_path_array(results.get_object_type(), key_paths));
     }
 
     results::results(const realm &realm, const table_view &tv) {
@@ -4,8 +4,10 @@
 #include <cpprealm/internal/bridge/obj.hpp>
 #include <cpprealm/internal/bridge/mixed.hpp>
 #include <cpprealm/internal/bridge/realm.hpp>
+#include <cpprealm/internal/bridge/results.hpp>
 
 #include <cpprealm/internal/bridge/table.hpp>
+#include <realm/object-store/results.hpp>
 #include <realm/object-store/set.hpp>
 
 #include <realm/array_mixed.hpp>
@@ -109,6 +111,10 @@ namespace realm::internal::bridge {
         return *get_set();
     }
 
+    results set::as_results() const {
+        return get_set()->as_results();
+    }
+
     table set::get_table() const {
         return get_set()->get_table();
     }
@@ -172,6 +178,15 @@ namespace realm::internal::bridge {
     size_t set::find(const binary& v) { return get_set()->find(v.operator BinaryData()); }
     size_t set::find(const obj_key& v) { return get_set()->find(v.operator ObjKey()); }
 
+    bool set::is_subset_of(const set& rhs) const { return get_set()->is_subset_of(*rhs.get_set()); }
+    bool set::is_superset_of(const set& rhs) const { return get_set()->is_superset_of(*rhs.get_set()); }
+    bool set::intersects(const set& rhs) const { return get_set()->intersects(*rhs.get_set()); }
+    bool set::set_equals(const set& rhs) const { return get_set()->set_equals(*rhs.get_set()); }
+    void set::assign_union(const set& rhs) { get_set()->assign_union(*rhs.get_set()); }
+    void set::assign_intersection(const set& rhs) { get_set()->assign_intersection(*rhs.get_set()); }
+    void set::assign_difference(const set& rhs) { get_set()->assign_difference(*rhs.get_set()); }
+    void set::assign_symmetric_difference(const set& rhs) { get_set()->assign_symmetric_difference(*rhs.get_set()); }
+
     notification_token set::add_notification_callback(std::shared_ptr<collection_change_callback> cb) {
         struct wrapper : CollectionChangeCallback {
             std::shared_ptr<collection_change_callback> m_cb;
@@ -4,10 +4,17 @@
 #include <cpprealm/internal/bridge/query.hpp>
 #include <cpprealm/internal/bridge/utils.hpp>
 
+#include <realm/dictionary.hpp>
+#include <realm/group.hpp>
+#include <realm/list.hpp>
 #include <realm/mixed.hpp>
+#include <realm/object_converter.hpp>
+#include <realm/set.hpp>
 #include <realm/table.hpp>
 #include <realm/table_view.hpp>
 
+#include <set>
+
 namespace realm::internal::bridge {
 
     table::table() {
@@ -141,9 +148,94 @@ namespace realm::internal::bridge {
     obj table::create_object_with_primary_key(const bridge::mixed& key) const {
         return static_cast<TableRef>(*this)->create_object_with_primary_key(key.operator ::realm::Mixed());
     }
+    namespace {
+        using link_target = std::pair<TableKey, Mixed>;
+
+        // Collects the objects linked from `src` and its embedded objects which have no object
+        // with the same primary key in `dst_group`, i.e. which the copy creates as stubs.
+        void collect_missing_links(const Obj& src, const Group& dst_group, std::set<link_target>& missing) {
+            auto src_table = src.get_table();
+            for (auto col : src_table->get_column_keys()) {
+                if (col.get_type() != col_type_Link) {
+                    continue;
+                }
+                auto src_target = src_table->get_link_target(col);
+                auto dst_target = src_target->is_embedded() ? ConstTableRef() : dst_group.get_table(src_target->get_name());
+                auto visit = [&](const Obj& linked) {
+                    if (!linked.is_valid()) {
+                        return;
+                    }
+                    if (src_target->is_embedded()) {
+                        collect_missing_links(linked, dst_group, missing);
+                    } else if (dst_target && src_target->get_primary_key_column()) {
+                        auto pk = linked.get_primary_key();
+                        if (!dst_target->find_primary_key(pk)) {
+                            missing.emplace(dst_target->get_key(), pk);
+                        }
+                    }
+                };
+                if (col.is_list()) {
+                    auto list = src.get_linklist(col);
+                    for (size_t i = 0; i < list.size(); i++) {
+                        visit(list.get_object(i));
+                    }
+                } else if (col.is_set()) {
+                    auto set = src.get_linkset(col);
+                    for (size_t i = 0; i < set.size(); i++) {
+                        visit(set.get_object(i));
+                    }
+                } else if (col.is_dictionary()) {
+                    auto dictionary = src.get_dictionary(col);
+                    for (size_t i = 0; i < dictionary.size(); i++) {
+                        auto value = dictionary.get_any(i);
+                        if (value.is_type(type_TypedLink)) {
+                            visit(src_target->get_object(value.get_link().get_obj_key()));
+                        }
+                    }
+                } else if (!src.is_null(col)) {
+                    visit(src.get_linked_object(col));
+                }
+            }
+        }
+    }
+
+    obj table::copy_object(const obj& source, size_t* created_links) const {
+        auto dst_table = static_cast<TableRef>(*this);
+        auto src = static_cast<Obj>(source);
+        auto src_table = src.get_table();
+        auto* group = dst_table->get_parent_group();
+        bool has_primary_key = bool(src_table->get_primary_key_column());
+        if (created_links && group) {
+            std::set<link_target> missing;
+            collect_missing_links(src, *group, missing);
+            if (has_primary_key) {
+                // A link to the copied object itself is resolved by the copy, not by a stub.
+                missing.erase({dst_table->get_key(), src.get_primary_key()});
+            }
+            *created_links += missing.size();
+        }
+        Obj dst = has_primary_key
+                  ? dst_table->create_object_with_primary_key(src.get_primary_key())
+                  : dst_table->create_object();
+        converters::EmbeddedObjectConverter embedded_objects;
+        converters::InterRealmObjectConverter converter(src_table, dst_table, &embedded_objects);
+        converter.copy(src, dst, nullptr);
+        embedded_objects.process_pending();
+        return dst;
+    }
+    std::optional<obj_key> table::find_primary_key(const bridge::mixed& key) const {
+        auto obj_key = static_cast<TableRef>(*this)->find_primary_key(key.operator ::realm::Mixed());
+        if (!obj_key) {
+            return std::nullopt;
+        }
+        return obj_key;
+    }
     bool table::is_valid(const obj_key &key) const {
         return static_cast<TableRef>(*this)->is_valid(key);
     }
+    uint64_t table::storage_ref() const {
+        return static_cast<TableRef>(*this)->get_ref();
+    }
     obj table::get_object(const obj_key &key) const {
         return static_cast<TableRef>(*this)->get_object(key);
     }
@@ -1,9 +1,15 @@
 #include <cpprealm/internal/bridge/thread_safe_reference.hpp>
 #include <cpprealm/internal/bridge/dictionary.hpp>
+#include <cpprealm/internal/bridge/list.hpp>
 #include <cpprealm/internal/bridge/object.hpp>
+#include <cpprealm/internal/bridge/results.hpp>
+#include <cpprealm/internal/bridge/set.hpp>
 
 #include <realm/object-store/dictionary.hpp>
+#include <realm/object-store/list.hpp>
 #include <realm/object-store/object.hpp>
+#include <realm/object-store/results.hpp>
+#include <realm/object-store/set.hpp>
 #include <realm/object-store/thread_safe_reference.hpp>
 
 #include <memory>
@@ -76,4 +82,25 @@ namespace realm::internal::bridge {
         m_thread_safe_reference = std::make_shared<ThreadSafeReference>(static_cast<Dictionary>(o));
 #endif
     }
-}
\ No newline at end of file
+    thread_safe_reference::thread_safe_reference(const list &o) {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        new (&m_thread_safe_reference) ThreadSafeReference(static_cast<List>(o));
+#else
+        m_thread_safe_reference = std::make_shared<ThreadSafeReference>(static_cast<List>(o));
+#endif
+    }
+    thread_safe_reference::thread_safe_reference(const results &o) {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        new (&m_thread_safe_reference) ThreadSafeReference(static_cast<Results>(o));
+#else
+        m_thread_safe_reference = std::make_shared<ThreadSafeReference>(static_cast<Results>(o));
+#endif
+    }
+    thread_safe_reference::thread_safe_reference(const set &o) {
+#ifdef CPPREALM_HAVE_GENERATED_BRIDGE_TYPES
+        new (&m_thread_safe_reference) ThreadSafeReference(static_cast<object_store::Set>(o));
+#else
+        m_thread_safe_reference = std::make_shared<ThreadSafeReference>(static_cast<object_store::Set>(o));
+#endif
+    }
+}
@@ -0,0 +1,133 @@
+#include <cpprealm/notifications.hpp>
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace realm::internal {
+    /**
+     One thread which waits for the earliest pending timer and hands its function to the
+     timer's scheduler. The queue is shared by every `delayed_invoker` and lives as long
+     as one of them holds it.
+     */
+    struct timer_queue {
+        timer_queue() : m_state(std::make_shared<state>()) {
+            m_thread = std::thread([state = m_state] {
+                run(*state);
+            });
+        }
+
+        ~timer_queue() {
+            {
+                std::lock_guard<std::mutex> lock(m_state->mutex);
+                m_state->stopping = true;
+                m_state->timers.clear();
+            }
+            m_state->condition.notify_one();
+            // The last holder can be a function run by the timer thread itself. Its state
+            // is shared with the thread, so it can finish on its own.
+            if (m_thread.get_id() == std::this_thread::get_id()) {
+                m_thread.detach();
+            } else {
+                m_thread.join();
+            }
+        }
+
+        uint64_t add(std::chrono::steady_clock::time_point due,
+                     const std::shared_ptr<scheduler>& scheduler,
+                     std::function<void()>&& fn) {
+            uint64_t id;
+            {
+                std::lock_guard<std::mutex> lock(m_state->mutex);
+                id = ++m_state->next_id;
+                m_state->timers.emplace(due, timer{id, scheduler, std::move(fn)});
+            }
+            m_state->condition.notify_one();
+            return id;
+        }
+
+        void cancel(uint64_t id) {
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            for (auto it = m_state->timers.begin(); it != m_state->timers.end(); ++it) {
+                if (it->second.id == id) {
+                    m_state->timers.erase(it);
+                    return;
+                }
+            }
+        }
+
+    private:
+        struct timer {
+            uint64_t id;
+            std::shared_ptr<struct scheduler> target;
+            std::function<void()> fn;
+        };
+        struct state {
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::multimap<std::chrono::steady_clock::time_point, timer> timers;
+            uint64_t next_id = 0;
+            bool stopping = false;
+        };
+
+        static void run(state& s) {
+            std::unique_lock<std::mutex> lock(s.mutex);
+            while (!s.stopping) {
+                if (s.timers.empty()) {
+                    s.condition.wait(lock);
+                    continue;
+                }
+                auto next = s.timers.begin();
+                if (next->first > std::chrono::steady_clock::now()) {
+                    s.condition.wait_until(lock, next->first);
+                    continue;
+                }
+                auto t = std::move(next->second);
+                s.timers.erase(next);
+                lock.unlock();
+                t.target->invoke(std::move(t.fn));
+                t = {};
+                lock.lock();
+            }
+        }
+
+        std::shared_ptr<state> m_state;
+        std::thread m_thread;
+    };
+
+    namespace {
+        std::shared_ptr<timer_queue> get_timer_queue() {
+            static std::mutex mutex;
+            static std::weak_ptr<timer_queue> shared_queue;
+            std::lock_guard<std::mutex> lock(mutex);
+            auto queue = shared_queue.lock();
+            if (!queue) {
+                queue = std::make_shared<timer_queue>();
+                shared_queue = queue;
+            }
+            return queue;
+        }
+    }
+
+    delayed_invoker::~delayed_invoker() {
+        cancel();
+    }
+
+    void delayed_invoker::invoke_after(const std::shared_ptr<scheduler>& scheduler,
+                                       std::chrono::milliseconds delay,
+                                       std::function<void()>&& fn) {
+        if (!m_queue) {
+            m_queue = get_timer_queue();
+        }
+        cancel();
+        m_timer = m_queue->add(std::chrono::steady_clock::now() + delay, scheduler, std::move(fn));
+    }
+
+    void delayed_invoker::cancel() {
+        if (m_queue && m_timer) {
+            m_queue->cancel(m_timer);
+            m_timer = 0;
+        }
+    }
+} // namespace realm::internal
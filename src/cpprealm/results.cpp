@@ -0,0 +1,53 @@
+#include <cpprealm/results.hpp>
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace realm::internal {
+    void parallel_for_chunks(size_t chunk_count, size_t concurrency, const std::function<void(size_t)>& fn) {
+        if (concurrency == 0) {
+            concurrency = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+        concurrency = std::min(concurrency, chunk_count);
+
+        std::atomic<size_t> next_chunk{0};
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+        std::mutex error_mutex;
+
+        auto work = [&]() {
+            while (!failed.load(std::memory_order_relaxed)) {
+                size_t chunk = next_chunk.fetch_add(1, std::memory_order_relaxed);
+                if (chunk >= chunk_count) {
+                    return;
+                }
+                try {
+                    fn(chunk);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                    failed = true;
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        if (concurrency > 1) {
+            threads.reserve(concurrency - 1);
+            for (size_t i = 1; i < concurrency; ++i) {
+                threads.emplace_back(work);
+            }
+        }
+        work();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+} // namespace realm::internal
@@ -0,0 +1,72 @@
+#include <cpprealm/sharded_db.hpp>
+
+#include <cpprealm/internal/scheduler/realm_core_scheduler.hpp>
+
+#include <realm/object-store/util/scheduler.hpp>
+
+namespace realm::internal {
+    shard_writer::shard_writer(db_config config) {
+        m_thread = std::thread([this, config = std::move(config)]() mutable {
+            run(std::move(config));
+        });
+    }
+
+    shard_writer::~shard_writer() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_condition.notify_one();
+        m_thread.join();
+    }
+
+    std::future<void> shard_writer::submit(std::function<void(db&)>&& fn) {
+        task t{std::move(fn), {}};
+        auto future = t.promise.get_future();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.push_back(std::move(t));
+        }
+        m_condition.notify_one();
+        return future;
+    }
+
+    void shard_writer::run(db_config config) {
+        // The config was created on another thread, so it needs a scheduler for this one.
+        // Nothing runs an event loop here, a generic scheduler is enough for writing.
+        config.set_scheduler(std::make_shared<realm_core_scheduler>(util::Scheduler::make_generic()));
+        std::optional<db> shard;
+        std::exception_ptr open_error;
+        try {
+            shard.emplace(std::move(config));
+        } catch (...) {
+            open_error = std::current_exception();
+        }
+
+        while (true) {
+            task t;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+                if (m_tasks.empty()) {
+                    break;
+                }
+                t = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            if (open_error) {
+                t.promise.set_exception(open_error);
+                continue;
+            }
+            try {
+                t.fn(*shard);
+                t.promise.set_value();
+            } catch (...) {
+                if (shard->is_in_write()) {
+                    shard->cancel_write();
+                }
+                t.promise.set_exception(std::current_exception());
+            }
+        }
+    }
+} // namespace realm::internal
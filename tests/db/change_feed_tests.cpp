@@ -0,0 +1,105 @@
+#include "../main.hpp"
+#include "test_objects.hpp"
+
+namespace realm {
+    TEST_CASE("change_feed") {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        auto realm = db(std::move(config));
+
+        auto add_object = [&](int64_t id) {
+            AllTypesObjectLink o;
+            o._id = id;
+            return realm.add(std::move(o));
+        };
+        auto first = realm.write([&] { return add_object(1); });
+        auto second = realm.write([&] { return add_object(2); });
+
+        std::vector<change_event> events;
+        auto feed = std::make_unique<change_feed<AllTypesObjectLink, StringObject>>(realm, std::nullopt, [&](const change_event& e) {
+            events.push_back(e);
+        });
+
+        auto third = realm.write([&] {
+            first.str_col = "modified";
+            realm.remove(second);
+            return add_object(3);
+        });
+        realm.refresh();
+
+        REQUIRE(events.size() == 1);
+        CHECK(events[0].object_type == "AllTypesObjectLink");
+        CHECK_FALSE(events[0].is_resync);
+        CHECK(events[0].version == realm.m_realm.read_transaction_version());
+        CHECK(events[0].insertions == std::vector<int64_t>{third.m_obj.get_key().value()});
+        CHECK(events[0].modifications == std::vector<int64_t>{first.m_obj.get_key().value()});
+        CHECK(events[0].deletions.size() == 1);
+
+        // Resuming from the saved cursor doesn't report anything again.
+        auto cursor = feed->cursor();
+        CHECK(cursor.version == events.back().version);
+        feed.reset();
+        events.clear();
+        feed = std::make_unique<change_feed<AllTypesObjectLink, StringObject>>(realm, cursor, [&](const change_event& e) {
+            events.push_back(e);
+        });
+        realm.write([&] {
+            first.str_col = "modified again";
+        });
+        realm.refresh();
+        REQUIRE(events.size() == 1);
+        CHECK_FALSE(events[0].is_resync);
+        CHECK(events[0].modifications == std::vector<int64_t>{first.m_obj.get_key().value()});
+
+        // The cursor advances over commits which don't change the watched types.
+        feed.reset();
+        events.clear();
+        auto link_feed = std::make_unique<change_feed<AllTypesObjectLink>>(realm, std::nullopt, [&](const change_event& e) {
+            events.push_back(e);
+        });
+        realm.write([&] {
+            realm.add(StringObject());
+        });
+        realm.refresh();
+        CHECK(events.empty());
+        cursor = link_feed->cursor();
+        CHECK(cursor.version == realm.m_realm.read_transaction_version());
+
+        // Commits to other tables while the feed was stopped don't require a resync.
+        link_feed.reset();
+        realm.write([&] {
+            realm.add(StringObject());
+        });
+        link_feed = std::make_unique<change_feed<AllTypesObjectLink>>(realm, cursor, [&](const change_event& e) {
+            events.push_back(e);
+        });
+        realm.write([&] {
+            first.str_col = "modified once more";
+        });
+        realm.refresh();
+        REQUIRE(events.size() == 1);
+        CHECK_FALSE(events[0].is_resync);
+        cursor = link_feed->cursor();
+
+        // Commits to a watched table while the feed was stopped can't be replayed, so the feed resyncs.
+        link_feed.reset();
+        events.clear();
+        realm.write([&] {
+            add_object(4);
+        });
+        link_feed = std::make_unique<change_feed<AllTypesObjectLink>>(realm, cursor, [&](const change_event& e) {
+            events.push_back(e);
+        });
+        // The cursor stays at the saved position until the resync has been delivered.
+        CHECK(link_feed->cursor().version == cursor.version);
+        realm.write([&] {
+            realm.add(StringObject());
+        });
+        realm.refresh();
+        REQUIRE(events.size() == 1);
+        CHECK(events[0].is_resync);
+        CHECK(events[0].insertions.size() == 3);
+        CHECK(link_feed->cursor().version == realm.m_realm.read_transaction_version());
+    }
+}
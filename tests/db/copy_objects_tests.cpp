@@ -0,0 +1,99 @@
+#include "../main.hpp"
+#include "test_objects.hpp"
+
+namespace realm {
+    TEST_CASE("copy_objects") {
+        realm_path source_path;
+        realm_path target_path;
+        realm::db_config source_config;
+        source_config.set_path(source_path);
+        realm::db_config target_config;
+        target_config.set_path(target_path);
+        auto source = db(source_config);
+        auto target = db(target_config);
+
+        source.write([&source] {
+            for (int64_t i = 0; i < 25; i++) {
+                AllTypesObject o;
+                o._id = i;
+                o.str_col = "object " + std::to_string(i);
+                o.list_int_col = {i, i + 1};
+                auto embedded = AllTypesObjectEmbedded();
+                embedded.str_col = "embedded " + std::to_string(i);
+                o.opt_embedded_obj_col = &embedded;
+                auto link = AllTypesObjectLink();
+                link._id = i;
+                link.str_col = "link " + std::to_string(i);
+                o.opt_obj_col = &link;
+                source.add(std::move(o));
+            }
+        });
+
+        SECTION("copies objects in batches") {
+            auto objects = source.objects<AllTypesObject>().where("_id >= $0", {int64_t(10)});
+            auto stats = copy_objects(objects, target, {4, false});
+            CHECK(stats.copied_objects == 15);
+            CHECK(stats.removed_objects == 0);
+            CHECK(stats.stub_objects == 15);
+            CHECK(stats.batches == 4);
+            CHECK(source.objects<AllTypesObject>().size() == 25);
+
+            auto copied = target.objects<AllTypesObject>();
+            REQUIRE(copied.size() == 15);
+            auto object = target.find<AllTypesObject>(int64_t(12));
+            REQUIRE(object);
+            CHECK(object->str_col == "object 12");
+            CHECK(object->list_int_col.size() == 2);
+            CHECK(object->opt_embedded_obj_col->str_col == "embedded 12");
+            // Links point to the object with the same primary key, which only has its primary key until it is copied.
+            CHECK(object->opt_obj_col->_id == 12);
+            CHECK(object->opt_obj_col->str_col == "");
+            auto links = source.objects<AllTypesObjectLink>();
+            CHECK(copy_objects(links, target).stub_objects == 0);
+            CHECK(object->opt_obj_col->str_col == "link 12");
+            CHECK(target.objects<AllTypesObjectLink>().size() == 25);
+
+            // Copying again updates the existing objects instead of adding new ones.
+            CHECK(copy_objects(objects, target).stub_objects == 0);
+            CHECK(target.objects<AllTypesObject>().size() == 15);
+        }
+
+        SECTION("removes copied objects from the source") {
+            auto objects = source.objects<AllTypesObject>();
+            auto stats = copy_objects(objects, target, {10, true});
+            CHECK(stats.copied_objects == 25);
+            CHECK(stats.removed_objects == 25);
+            CHECK(stats.batches == 3);
+            CHECK(source.objects<AllTypesObject>().size() == 0);
+            CHECK(target.objects<AllTypesObject>().size() == 25);
+            // Linked objects are not part of the copy and stay in the source.
+            CHECK(source.objects<AllTypesObjectLink>().size() == 25);
+        }
+
+        SECTION("counts each missing link target once") {
+            target.write([&target] {
+                AllTypesObjectLink link;
+                link._id = 101;
+                target.add(std::move(link));
+            });
+            source.write([&source] {
+                auto missing = AllTypesObjectLink();
+                missing._id = 100;
+                auto existing = AllTypesObjectLink();
+                existing._id = 101;
+                AllTypesObject o;
+                o._id = 100;
+                o.opt_obj_col = &missing;
+                o.list_obj_col = {&missing, &existing};
+                o.set_obj_col = {&missing};
+                o.map_link_col = {{"missing", &missing}, {"existing", &existing}};
+                source.add(std::move(o));
+            });
+            auto objects = source.objects<AllTypesObject>().where("_id == $0", {int64_t(100)});
+            auto stats = copy_objects(objects, target);
+            CHECK(stats.copied_objects == 1);
+            CHECK(stats.stub_objects == 1);
+            CHECK(target.objects<AllTypesObjectLink>().size() == 2);
+        }
+    }
+}
@@ -0,0 +1,108 @@
+#include "../main.hpp"
+#include "test_objects.hpp"
+
+#include <thread>
+
+namespace realm {
+    TEST_CASE("db_pool") {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+
+        SECTION("reuses the instance of the calling thread") {
+            db_pool pool;
+            auto first = pool.get(config);
+            auto second = pool.get(config);
+            CHECK(first.m_realm == second.m_realm);
+            CHECK(pool.stats().hits == 1);
+            CHECK(pool.stats().misses == 1);
+
+            std::thread([&pool, &path, &first] {
+                realm::db_config thread_config;
+                thread_config.set_path(path);
+                auto realm = pool.get(thread_config);
+                CHECK(realm.m_realm != first.m_realm);
+                CHECK(pool.get(thread_config).m_realm == realm.m_realm);
+            }).join();
+            CHECK(pool.stats().hits == 2);
+            CHECK(pool.stats().misses == 2);
+        }
+
+        SECTION("refreshes on checkout") {
+            db_pool pool;
+            auto realm = pool.get(config);
+            CHECK(realm.objects<AllTypesObject>().size() == 0);
+
+            std::thread([&path] {
+                realm::db_config thread_config;
+                thread_config.set_path(path);
+                auto writer = db(std::move(thread_config));
+                writer.write([&writer] {
+                    AllTypesObject o;
+                    o._id = 1;
+                    writer.add(std::move(o));
+                });
+            }).join();
+
+            CHECK(pool.get(config).objects<AllTypesObject>().size() == 1);
+        }
+
+        SECTION("evicts idle instances") {
+            db_pool pool(std::chrono::milliseconds(0));
+            auto realm = pool.get(config);
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            pool.evict_idle();
+            CHECK(pool.stats().evictions == 1);
+
+            // Instances which were checked out stay usable after being evicted.
+            realm.write([&realm] {
+                AllTypesObject o;
+                o._id = 1;
+                realm.add(std::move(o));
+            });
+            pool.get(config);
+            CHECK(pool.stats().misses == 2);
+        }
+
+        SECTION("keys instances on the schema") {
+            db_pool pool;
+            auto all_types = pool.get(config);
+            auto subset_config = config;
+            std::vector<internal::bridge::object_schema> schema;
+            schema.push_back(managed<StringObject>::schema.to_core_schema());
+            subset_config.set_schema(schema);
+            CHECK_FALSE(subset_config.opens_same_realm(config));
+            pool.get(subset_config);
+            CHECK(pool.stats().misses == 2);
+            CHECK(pool.get(config).m_realm == all_types.m_realm);
+            CHECK(pool.stats().hits == 1);
+        }
+
+        SECTION("other threads release the instances of a destroyed pool") {
+            auto pool = std::make_unique<db_pool>();
+            pool->get(config);
+            std::thread([&pool] {
+                pool.reset();
+            }).join();
+
+            auto can_compact = [&path] {
+                bool compacted = false;
+                std::thread([&path, &compacted] {
+                    realm::db_config thread_config;
+                    thread_config.set_path(path);
+                    compacted = db(std::move(thread_config)).compact();
+                }).join();
+                return compacted;
+            };
+            // This thread still holds the instance it opened through the destroyed pool.
+            CHECK_FALSE(can_compact());
+
+            realm_path other_path;
+            realm::db_config other_config;
+            other_config.set_path(other_path);
+            db_pool other_pool;
+            other_pool.get(other_config);
+            CHECK(can_compact());
+        }
+    }
+}
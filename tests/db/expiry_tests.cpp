@@ -0,0 +1,70 @@
+#include "../main.hpp"
+#include "test_objects.hpp"
+
+namespace realm {
+    TEST_CASE("expiry_sweeper") {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        auto realm = db(config);
+        auto now = std::chrono::system_clock::now();
+
+        auto add_objects = [&](int64_t first_id, int64_t count, std::chrono::system_clock::time_point date) {
+            realm.write([&] {
+                for (int64_t i = first_id; i < first_id + count; i++) {
+                    AllTypesObject o;
+                    o._id = i;
+                    o.date_col = date;
+                    realm.add(std::move(o));
+                }
+            });
+        };
+
+        SECTION("expire_after") {
+            add_objects(0, 25, now - std::chrono::hours(2));
+            add_objects(100, 5, now);
+            // The sweeper only runs when asked to in this test.
+            expiry_sweeper sweeper(config, std::chrono::hours(1), 10);
+            sweeper.expire_after<AllTypesObject>("date_col", std::chrono::hours(1));
+            sweeper.sweep();
+
+            realm.refresh();
+            auto remaining = realm.objects<AllTypesObject>();
+            CHECK(remaining.size() == 5);
+            CHECK(remaining.where([](auto& o) { return o._id < 100; }).size() == 0);
+            auto stats = sweeper.stats();
+            CHECK(stats.sweeps == 1);
+            CHECK(stats.failed_sweeps == 0);
+            CHECK(stats.deleted_objects == 25);
+            CHECK(stats.max_sweep_duration >= stats.last_sweep_duration);
+        }
+
+        SECTION("limit_count") {
+            add_objects(0, 10, now - std::chrono::hours(1));
+            add_objects(10, 10, now);
+            expiry_sweeper sweeper(config, std::chrono::hours(1), 3);
+            sweeper.limit_count<AllTypesObject>("date_col", 10);
+            sweeper.sweep();
+
+            realm.refresh();
+            CHECK(realm.objects<AllTypesObject>().size() == 10);
+            CHECK(realm.objects<AllTypesObject>().where([](auto& o) { return o._id < 10; }).size() == 0);
+            CHECK(sweeper.stats().deleted_objects == 10);
+
+            sweeper.sweep();
+            CHECK(sweeper.stats().sweeps == 2);
+            CHECK(sweeper.stats().deleted_objects == 10);
+        }
+
+        SECTION("periodic sweeps") {
+            expiry_sweeper sweeper(config, std::chrono::milliseconds(10));
+            sweeper.expire_after<AllTypesObject>("date_col");
+            add_objects(0, 5, now);
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (sweeper.stats().deleted_objects < 5 && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            CHECK(sweeper.stats().deleted_objects == 5);
+        }
+    }
+}
@@ -747,6 +747,52 @@ TEST_CASE("list", "[list]") {
         CHECK(sorted_object_results24[1] == AllTypesObject::Enum::one);
     }
 
+    SECTION("link list scoped queries") {
+        auto realm = realm::db(std::move(config));
+        auto managed_obj = realm.write([&]() {
+            AllTypesObjectLink outside;
+            outside._id = 100;
+            outside.str_col = "foo";
+            realm.add(std::move(outside));
+            return realm.add(realm::AllTypesObject());
+        });
+
+        AllTypesObjectLink link1;
+        link1._id = 1;
+        link1.str_col = "foo";
+        AllTypesObjectLink link2;
+        link2._id = 2;
+        link2.str_col = "bar";
+        AllTypesObjectLink link3;
+        link3._id = 3;
+        link3.str_col = "bar";
+        realm.write([&]() {
+            managed_obj.list_obj_col.push_back(&link1);
+            managed_obj.list_obj_col.push_back(&link2);
+            managed_obj.list_obj_col.push_back(&link3);
+        });
+
+        auto foo = managed_obj.list_obj_col.where([](auto& o) { return o.str_col == "foo"; });
+        CHECK(foo.size() == 1);
+        CHECK(foo[0]._id == 1);
+        CHECK(managed_obj.list_obj_col.where("str_col == $0", {std::string("foo")}).size() == 1);
+
+        auto bar = managed_obj.list_obj_col.where([](auto& o) { return o.str_col == "bar"; });
+        CHECK(bar.size() == 2);
+        CHECK(bar.where([](auto& o) { return o._id > 2; }).size() == 1);
+
+        auto sorted = managed_obj.list_obj_col.sort("_id", false);
+        CHECK(sorted.size() == 3);
+        CHECK(sorted[0]._id == 3);
+        CHECK(managed_obj.list_obj_col.distinct({"str_col"}).size() == 2);
+
+        CHECK(std::get<int64_t>(*managed_obj.list_obj_col.max("_id")) == 3);
+        CHECK(std::get<int64_t>(*managed_obj.list_obj_col.min("_id")) == 1);
+        CHECK(std::get<int64_t>(*managed_obj.list_obj_col.sum("_id")) == 6);
+        CHECK(std::get<double>(*managed_obj.list_obj_col.average("_id")) == 2.0);
+        CHECK(std::get<int64_t>(*realm.objects<AllTypesObjectLink>().max("_id")) == 100);
+    }
+
     SECTION("object lifetime") {
         managed<StringObject> out_of_scope_obj;
         {
@@ -223,6 +223,37 @@ TEST_CASE("map", "[map]") {
         CHECK_FALSE(managed_obj.map_str_col.contains_key("c"));
     }
 
+    SECTION("batch_insert_get_erase") {
+        auto obj = AllTypesObject();
+        obj.map_int_col = {
+                {"a", 1}
+        };
+
+        auto realm = db(std::move(config));
+        auto managed_obj = realm.write([&realm, &obj] {
+            return realm.add(std::move(obj));
+        });
+
+        realm.write([&] {
+            managed_obj.map_int_col.insert_many({{"a", 10}, {"b", 20}, {"c", 30}});
+        });
+        CHECK(managed_obj.map_int_col.size() == 3);
+        CHECK(managed_obj.map_int_col.get_many({"a", "c", "d"}) == std::map<std::string, int64_t>({{"a", 10}, {"c", 30}}));
+
+        std::vector<std::string> keys;
+        for (auto key : managed_obj.map_int_col.keys()) {
+            keys.emplace_back(key);
+        }
+        std::sort(keys.begin(), keys.end());
+        CHECK(keys == std::vector<std::string>({"a", "b", "c"}));
+
+        size_t erased = realm.write([&] {
+            return managed_obj.map_int_col.erase_many({"a", "b", "d"});
+        });
+        CHECK(erased == 2);
+        CHECK(managed_obj.map_int_col.detach() == std::map<std::string, int64_t>({{"c", 30}}));
+    }
+
     SECTION("object lifetime") {
         managed<AllTypesObjectLink> ptr;
         {
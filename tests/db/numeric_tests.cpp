@@ -88,6 +88,12 @@ TEST_CASE("numerics", "[numerics]") {
 
             managed_obj.int_col--;
             CHECK(managed_obj.int_col == 4);
+
+            managed_obj.int_col.increment(10);
+            CHECK(managed_obj.int_col == 14);
+
+            managed_obj.int_col.decrement(4);
+            CHECK(managed_obj.int_col == 10);
         });
 
         // Double
@@ -2,9 +2,41 @@
 #include "test_objects.hpp"
 
 #include <iostream>
+#include <mutex>
+#include <queue>
+#include <thread>
 
 namespace realm {
 
+    // Collects invoked functions until the test runs them explicitly.
+    struct queue_scheduler final : public realm::scheduler {
+        void invoke(std::function<void()> &&fn) override {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queue.push(std::move(fn));
+        }
+        bool is_on_thread() const noexcept override { return true; }
+        bool is_same_as(const scheduler *other) const noexcept override { return this == other; }
+        bool can_invoke() const noexcept override { return true; }
+
+        size_t run_all() {
+            std::queue<std::function<void()>> queue;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                std::swap(queue, m_queue);
+            }
+            size_t count = queue.size();
+            while (!queue.empty()) {
+                queue.front()();
+                queue.pop();
+            }
+            return count;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::queue<std::function<void()>> m_queue;
+    };
+
     enum class PrimaryKeyEnum {
         one,
         two
@@ -144,6 +176,18 @@ namespace realm {
             CHECK(realm.objects<PK5>().where([](auto& o) { return o._id == PrimaryKeyEnum::one; }).size() == 1);
             CHECK(realm.objects<PK5>().where([](auto& o) { return o._id != PrimaryKeyEnum::one; }).size() == 0);
 
+            CHECK(realm.find<PK1>(123)->str_col == "pk1");
+            CHECK_FALSE(realm.find<PK1>(321));
+            CHECK(realm.find<PK2>(obj_id)->str_col == "pk2");
+            CHECK(realm.find<PK3>("primary_key")->str_col == "pk3");
+            CHECK_FALSE(realm.find<PK3>("pk3"));
+            CHECK(realm.find<PK4>(realm::uuid("68b696d7-320b-4402-a412-d9cee10fc6a3"))->str_col == "pk4");
+            CHECK(realm.find<PK5>(PrimaryKeyEnum::one)->str_col == "pk5");
+            auto found = realm.find_many<PK1>(std::vector<int64_t>{321, 123});
+            REQUIRE(found.size() == 2);
+            CHECK_FALSE(found[0]);
+            CHECK(found[1]->str_col == "pk1");
+
             static_assert(std::is_assignable<managed<primary_key<int64_t>>, int64_t>::value == false);
             static_assert(std::is_assignable<managed<primary_key<realm::object_id>>, realm::object_id>::value == false);
             static_assert(std::is_assignable<managed<primary_key<std::string>>, std::string>::value == false);
@@ -670,6 +714,194 @@ namespace realm {
             CHECK(run_count == 2);
         }
 
+        SECTION("object_notifications_delivery_scheduler") {
+            db realm = realm::db(config);
+            auto managed_foo = realm.write([&realm]() {
+                return realm.add(AllTypesObject());
+            });
+
+            auto delivery = std::make_shared<queue_scheduler>();
+            observe_options options;
+            options.delivery_scheduler = delivery;
+            std::vector<PropertyChange<managed<AllTypesObject>>> changes;
+            int run_count = 0;
+            auto token = managed_foo.observe([&](auto&& change) {
+                CHECK(change.object == nullptr);
+                run_count++;
+                changes = std::move(change.property_changes);
+            }, options);
+
+            realm.write([&]() {
+                managed_foo.str_col = "foo";
+                managed_foo.double_col = 2.5;
+            });
+            realm.refresh();
+            CHECK(changes.empty());
+            CHECK(delivery->run_all() == 1);
+            REQUIRE(changes.size() == 2);
+            CHECK(changes[0].name == "double_col");
+            CHECK(std::get<double>(*changes[0].new_value) == 2.5);
+            CHECK(changes[1].name == "str_col");
+            CHECK(std::get<std::string>(*changes[1].new_value) == "foo");
+
+            // Changes still queued when the token is released are dropped.
+            realm.write([&]() {
+                managed_foo.str_col = "bar";
+            });
+            realm.refresh();
+            token.unregister();
+            delivery->run_all();
+            CHECK(run_count == 1);
+        }
+
+        SECTION("object_notifications_min_interval") {
+            // Delayed flushes are invoked on the Realm's scheduler, which this test runs by hand.
+            auto scheduler = std::make_shared<queue_scheduler>();
+            auto scheduled_config = config;
+            scheduled_config.set_scheduler(scheduler);
+            db realm = realm::db(scheduled_config);
+            auto managed_foo = realm.write([&realm]() {
+                return realm.add(AllTypesObject());
+            });
+
+            observe_options options;
+            options.min_interval = std::chrono::milliseconds(50);
+            std::vector<PropertyChange<managed<AllTypesObject>>> changes;
+            int run_count = 0;
+            auto token = managed_foo.observe([&](auto&& change) {
+                run_count++;
+                changes = std::move(change.property_changes);
+            }, options);
+
+            // Nothing was delivered yet, so the first change isn't held back.
+            realm.write([&]() {
+                managed_foo.str_col = "a";
+            });
+            realm.refresh();
+            CHECK(run_count == 1);
+
+            realm.write([&]() {
+                managed_foo.str_col = "b";
+            });
+            realm.refresh();
+            realm.write([&]() {
+                managed_foo.str_col = "c";
+            });
+            realm.refresh();
+            CHECK(run_count == 1);
+
+            for (int i = 0; i < 500 && run_count == 1; i++) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                scheduler->run_all();
+            }
+            CHECK(run_count == 2);
+            REQUIRE(changes.size() == 1);
+            CHECK(changes[0].name == "str_col");
+            CHECK(std::get<std::string>(*changes[0].new_value) == "c");
+        }
+
+        SECTION("add_update_modified") {
+            db realm = realm::db(config);
+            AllTypesObject obj;
+            obj._id = 1;
+            obj.str_col = "foo";
+            obj.list_int_col = {1, 2};
+            obj.map_str_col = {{"a", "b"}};
+            auto managed_obj = realm.write([&]() {
+                return realm.add(AllTypesObject(obj));
+            });
+
+            std::vector<std::string> changed;
+            int run_count = 0;
+            auto token = managed_obj.observe([&](auto&& change) {
+                run_count++;
+                for (auto& p : change.property_changes) {
+                    changed.push_back(p.name);
+                }
+            });
+
+            realm.write([&]() {
+                realm.add(AllTypesObject(obj), update_policy::modified);
+            });
+            realm.refresh();
+            CHECK(run_count == 0);
+
+            obj.str_col = "bar";
+            obj.map_str_col["c"] = "d";
+            auto updated = realm.write([&]() {
+                return realm.add(AllTypesObject(obj), update_policy::modified);
+            });
+            realm.refresh();
+            CHECK(run_count == 1);
+            CHECK(changed == std::vector<std::string>{"str_col", "map_str_col"});
+            CHECK(updated.str_col == "bar");
+            CHECK(updated.list_int_col.size() == 2);
+            CHECK(realm.objects<AllTypesObject>().size() == 1);
+        }
+
+        SECTION("add_update_modified_collections_and_links") {
+            db realm = realm::db(config);
+            AllTypesObjectLink link1;
+            link1._id = 1;
+            link1.str_col = "one";
+            AllTypesObjectLink link2;
+            link2._id = 2;
+            link2.str_col = "two";
+            AllTypesObjectEmbedded embedded;
+            embedded.str_col = "embedded";
+            AllTypesObject obj;
+            obj._id = 1;
+            obj.list_bool_col = {true, false};
+            obj.set_int_col = {1, 2, 3};
+            obj.map_str_col = {{"a", "b"}, {"c", "d"}};
+            obj.list_obj_col = {&link1, &link2};
+            obj.list_embedded_obj_col = {&embedded};
+            obj.opt_obj_col = &link1;
+            obj.opt_embedded_obj_col = &embedded;
+            auto managed_obj = realm.write([&]() {
+                return realm.add(AllTypesObject(obj));
+            });
+
+            int run_count = 0;
+            auto token = managed_obj.observe([&](auto&&) {
+                run_count++;
+            });
+
+            // Links, embedded objects and collections which are equal by value are left alone.
+            realm.write([&]() {
+                realm.add(AllTypesObject(obj), update_policy::modified);
+            });
+            realm.refresh();
+            CHECK(run_count == 0);
+            CHECK(managed_obj.list_bool_col.size() == 2);
+            CHECK(managed_obj.list_obj_col.size() == 2);
+            CHECK(managed_obj.list_embedded_obj_col.size() == 1);
+            CHECK(realm.objects<AllTypesObjectLink>().size() == 2);
+
+            embedded.str_col = "changed";
+            obj.list_bool_col = {true};
+            obj.set_int_col = {1};
+            obj.map_str_col = {{"a", "b"}};
+            obj.list_obj_col = {&link2};
+            obj.opt_obj_col = nullptr;
+            realm.write([&]() {
+                realm.add(AllTypesObject(obj), update_policy::modified);
+            });
+            realm.refresh();
+            CHECK(run_count == 1);
+            CHECK(managed_obj.list_bool_col.detach() == std::vector<bool>{true});
+            CHECK(managed_obj.set_int_col.detach() == std::set<int64_t>{1});
+            CHECK(managed_obj.map_str_col.size() == 1);
+            CHECK(managed_obj.map_str_col.find("c") == managed_obj.map_str_col.end());
+            REQUIRE(managed_obj.list_obj_col.size() == 1);
+            CHECK(managed_obj.list_obj_col[0]->_id == 2);
+            REQUIRE(managed_obj.list_embedded_obj_col.size() == 1);
+            CHECK(managed_obj.list_embedded_obj_col[0]->str_col == "changed");
+            CHECK(managed_obj.opt_embedded_obj_col->str_col == "changed");
+            CHECK(managed_obj.opt_obj_col == nullptr);
+            CHECK(realm.objects<AllTypesObjectLink>().size() == 2);
+        }
+
         SECTION("optional objects") {
             auto realm = db(std::move(config));
 
@@ -1,8 +1,39 @@
 #include "../main.hpp"
 #include "test_objects.hpp"
 
+#include <thread>
+
 using namespace realm;
 
+namespace {
+    // Commits one object per write transaction, so the cost of each commit dominates.
+    void insert_rows_one_per_commit(db& realm, int64_t first, int64_t count) {
+        for (int64_t i = first; i < first + count; i++) {
+            realm.write([&] {
+                AllTypesObjectLink o;
+                o._id = i;
+                realm.add(std::move(o));
+            });
+        }
+    }
+
+    void insert_rows(db& realm, int64_t count) {
+        realm.write([&] {
+            for (int64_t i = 0; i < count; i++) {
+                AllTypesObjectLink o;
+                o._id = i;
+                realm.add(std::move(o));
+            }
+        });
+    }
+
+    int64_t sum_ids(results<AllTypesObjectLink>& objects, size_t concurrency) {
+        return objects.parallel_reduce(int64_t(0), [](auto&& o) {
+            return static_cast<int64_t>(o._id);
+        }, [](int64_t a, int64_t b) { return a + b; }, concurrency);
+    }
+}
+
 TEST_CASE("basic_performance", "[performance]") {
     BENCHMARK_ADVANCED("write 1000")(Catch::Benchmark::Chronometer meter) {
         realm_path path;
@@ -86,4 +117,148 @@ TEST_CASE("basic_performance", "[performance]") {
             }
         });
     };
+
+    // Catch runs the setup in a benchmark's body for every sample, so the 1M rows shared by
+    // the lookup benchmarks below are inserted once up front.
+    realm_path large_path;
+    realm::db_config large_config;
+    large_config.set_path(large_path);
+    auto large_realm = db(std::move(large_config));
+    insert_rows(large_realm, 1000000);
+    auto managed_obj = large_realm.write([&] {
+        return large_realm.add(AllTypesObject());
+    });
+    large_realm.write([&] {
+        for (int64_t i = 0; i < 20; i++) {
+            managed_obj.list_obj_col.push_back(*large_realm.find<AllTypesObjectLink>(i * 1000));
+        }
+    });
+
+    BENCHMARK_ADVANCED("find by primary key in 1M")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            for (int64_t i = 0; i < 1000; i++) {
+                CHECK(large_realm.find<AllTypesObjectLink>(i * 997)->_id == i * 997);
+            }
+        });
+    };
+
+    BENCHMARK_ADVANCED("query by primary key in 1M")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            for (int64_t i = 0; i < 1000; i++) {
+                auto results = large_realm.objects<AllTypesObjectLink>().where([&](auto& o) { return o._id == i * 997; });
+                CHECK(results[0]._id == i * 997);
+            }
+        });
+    };
+
+    BENCHMARK_ADVANCED("query link list of 20 with 1M targets")(Catch::Benchmark::Chronometer meter) {
+        return meter.measure([&]() {
+            auto results = managed_obj.list_obj_col.where([](auto& o) { return o._id >= 10000; });
+            CHECK(results.size() == 10);
+        });
+    };
+
+    BENCHMARK_ADVANCED("1000 commits, on disk")(Catch::Benchmark::Chronometer meter) {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        auto realm = db(std::move(config));
+        int64_t next_id = 0;
+
+        return meter.measure([&]() {
+            insert_rows_one_per_commit(realm, next_id, 1000);
+            next_id += 1000;
+        });
+    };
+
+    BENCHMARK_ADVANCED("1000 commits, on disk without sync to disk")(Catch::Benchmark::Chronometer meter) {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        auto realm = db(std::move(config));
+        int64_t next_id = 0;
+
+        disable_sync_to_disk();
+        meter.measure([&]() {
+            insert_rows_one_per_commit(realm, next_id, 1000);
+            next_id += 1000;
+        });
+        disable_sync_to_disk(false);
+    };
+
+    BENCHMARK_ADVANCED("1000 commits, in memory")(Catch::Benchmark::Chronometer meter) {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        config.set_in_memory(true);
+        auto realm = db(std::move(config));
+        int64_t next_id = 0;
+
+        return meter.measure([&]() {
+            insert_rows_one_per_commit(realm, next_id, 1000);
+            next_id += 1000;
+        });
+    };
+
+    BENCHMARK_ADVANCED("open db 1000 times")(Catch::Benchmark::Chronometer meter) {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        auto realm = db(config);
+
+        return meter.measure([&]() {
+            for (int i = 0; i < 1000; i++) {
+                auto other = db(config);
+            }
+        });
+    };
+
+    BENCHMARK_ADVANCED("check out db from pool 1000 times")(Catch::Benchmark::Chronometer meter) {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        db_pool pool;
+        pool.get(config);
+
+        return meter.measure([&]() {
+            for (int i = 0; i < 1000; i++) {
+                auto other = pool.get(config);
+            }
+        });
+    };
+
+    std::vector<size_t> thread_counts = {1, 2, 4};
+    if (std::thread::hardware_concurrency() > 4) {
+        thread_counts.push_back(std::thread::hardware_concurrency());
+    }
+    auto large_results = large_realm.objects<AllTypesObjectLink>();
+    for (size_t threads : thread_counts) {
+        BENCHMARK_ADVANCED("parallel sum over 1M, " + std::to_string(threads) + " threads")(Catch::Benchmark::Chronometer meter) {
+            return meter.measure([&]() {
+                CHECK(sum_ids(large_results, threads) == 499999500000);
+            });
+        };
+    }
+
+    for (size_t shards : {1, 4}) {
+        BENCHMARK_ADVANCED("sharded write 100000, " + std::to_string(shards) + " shards")(Catch::Benchmark::Chronometer meter) {
+            realm_path path;
+            realm::db_config config;
+            config.set_path(path);
+            std::vector<realm_path> shard_paths(shards);
+            for (size_t i = 0; i < shards; i++) {
+                shard_paths[i].path = path.path + ".shard-" + std::to_string(i);
+            }
+            auto sharded = sharded_db<AllTypesObjectLink, StringObject>(config, shards);
+            int64_t next_id = 0;
+
+            return meter.measure([&]() {
+                std::vector<AllTypesObjectLink> objects(100000);
+                for (auto& o : objects) {
+                    o._id = next_id++;
+                }
+                sharded.add(std::move(objects));
+            });
+        };
+    }
 }
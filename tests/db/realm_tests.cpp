@@ -2,6 +2,8 @@
 #include "realm/object-store/shared_realm.hpp"
 #include "test_objects.hpp"
 
+#include <numeric>
+
 namespace realm {
 
     TEST_CASE("cached realm") {
@@ -62,6 +64,401 @@ namespace realm {
         p.get_future().get();
     }
 
+    TEST_CASE("tsr_collections") {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        auto realm = db(std::move(config));
+
+        AllTypesObject obj;
+        obj._id = 1;
+        obj.list_int_col = {1, 2, 3};
+        obj.set_int_col = {4, 5};
+        obj.map_int_col = {{"a", 1}, {"b", 2}};
+        auto managed_obj = realm.write([&realm, &obj] {
+            AllTypesObject other;
+            other._id = 2;
+            realm.add(std::move(other));
+            return realm.add(std::move(obj));
+        });
+
+        auto results = realm.objects<AllTypesObject>().where([](auto& o) { return o._id == 1; });
+        auto results_tsr = thread_safe_reference<realm::results<AllTypesObject>>(results);
+        auto list_tsr = thread_safe_reference<std::vector<int64_t>>(managed_obj.list_int_col);
+        auto set_tsr = thread_safe_reference<std::set<int64_t>>(managed_obj.set_int_col);
+        auto map_tsr = thread_safe_reference<std::map<std::string, int64_t>>(managed_obj.map_int_col);
+        auto t = std::thread([&]() {
+            realm::db_config config2;
+            config2.set_path(path);
+            auto realm = db(std::move(config2));
+            auto resolved_results = realm.resolve(std::move(results_tsr));
+            CHECK(resolved_results.size() == 1);
+            CHECK(resolved_results[0]._id == 1);
+            auto list = realm.resolve(std::move(list_tsr));
+            CHECK(list.size() == 3);
+            CHECK(list[2] == 3);
+            CHECK(realm.resolve(std::move(set_tsr)).size() == 2);
+            auto map = realm.resolve(std::move(map_tsr));
+            CHECK(map == std::map<std::string, int64_t>{{"a", 1}, {"b", 2}});
+        });
+        t.join();
+    }
+
+    TEST_CASE("read scope") {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        auto realm = db(config);
+        realm.write([&realm] {
+            AllTypesObject obj;
+            obj._id = 1;
+            realm.add(std::move(obj));
+        });
+
+        auto add_on_other_thread = [&](int64_t id) {
+            std::thread([&path, id] {
+                realm::db_config other_config;
+                other_config.set_path(path);
+                auto other_realm = db(std::move(other_config));
+                other_realm.write([&] {
+                    AllTypesObject obj;
+                    obj._id = id;
+                    other_realm.add(std::move(obj));
+                });
+            }).join();
+        };
+
+        auto counts = realm.read([&](read_view& view) {
+            auto before = view.objects<AllTypesObject>().size();
+            add_on_other_thread(2);
+            auto after = view.objects<AllTypesObject>().size();
+            CHECK_FALSE(view.find<AllTypesObject>(2));
+            CHECK(view.find<AllTypesObject>(1));
+            return std::make_pair(before, after);
+        });
+        CHECK(counts.first == 1);
+        CHECK(counts.second == 1);
+        CHECK(realm.m_realm.auto_refresh());
+
+        realm.refresh();
+        CHECK(realm.objects<AllTypesObject>().size() == 2);
+
+        CHECK_THROWS(realm.read([](read_view&) {
+            throw std::runtime_error("stop");
+        }));
+        CHECK(realm.m_realm.auto_refresh());
+    }
+
+    TEST_CASE("frozen realm cache") {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        auto realm = db(config);
+        realm.write([&realm] {
+            AllTypesObject obj;
+            obj._id = 1;
+            realm.add(std::move(obj));
+        });
+
+        auto stats_before = get_frozen_realm_stats();
+        {
+            auto frozen = realm.freeze();
+            auto frozen_results = realm.objects<AllTypesObject>().freeze();
+            auto frozen_object = realm.objects<AllTypesObject>()[0].freeze();
+            CHECK(frozen.m_realm == frozen_results[0].m_realm);
+            CHECK(frozen.m_realm == frozen_object.m_realm);
+
+            std::thread([&path] {
+                realm::db_config other_config;
+                other_config.set_path(path);
+                auto other_realm = db(std::move(other_config));
+                other_realm.freeze();
+            }).join();
+
+            auto stats = get_frozen_realm_stats();
+            CHECK(stats.pinned_versions[path.path].size() == 1);
+            CHECK(stats.misses == stats_before.misses + 1);
+            CHECK(stats.hits == stats_before.hits + 3);
+
+            realm.write([&realm] {
+                AllTypesObject obj;
+                obj._id = 2;
+                realm.add(std::move(obj));
+            });
+            auto newer = realm.freeze();
+            CHECK(newer.m_realm != frozen.m_realm);
+            CHECK(get_frozen_realm_stats().pinned_versions[path.path].size() == 2);
+        }
+        CHECK(get_frozen_realm_stats().pinned_versions.count(path.path) == 0);
+
+        SECTION("closing a frozen db only closes that handle") {
+            auto frozen = realm.freeze();
+            auto frozen_results = realm.objects<AllTypesObject>().freeze();
+            auto other = realm.freeze();
+            frozen.close();
+            CHECK(frozen.is_closed());
+            CHECK_THROWS(frozen.objects<AllTypesObject>().size());
+            // Closing it again does nothing.
+            frozen.close();
+            CHECK_FALSE(other.is_closed());
+            CHECK(other.objects<AllTypesObject>().size() == 2);
+            CHECK(frozen_results.size() == 2);
+        }
+
+        SECTION("frozen Realms are only shared by equal configurations") {
+            auto frozen = realm.freeze();
+            std::optional<db> frozen_subset;
+            std::thread([&path, &frozen_subset] {
+                realm::db_config subset_config;
+                subset_config.set_path(path);
+                auto subset = open<StringObject>(subset_config);
+                frozen_subset = subset.freeze();
+            }).join();
+            REQUIRE(frozen_subset);
+            CHECK(frozen_subset->m_realm != frozen.m_realm);
+            // Both pin the same version.
+            CHECK(get_frozen_realm_stats().pinned_versions[path.path].size() == 1);
+        }
+    }
+
+    TEST_CASE("in memory") {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        CHECK_FALSE(config.in_memory());
+        config.set_in_memory(true);
+        CHECK(config.in_memory());
+        {
+            auto realm = db(config);
+            realm.write([&realm] {
+                AllTypesObject obj;
+                obj._id = 1;
+                realm.add(std::move(obj));
+            });
+
+            std::thread([&path] {
+                realm::db_config other_config;
+                other_config.set_path(path);
+                other_config.set_in_memory(true);
+                auto other_realm = db(std::move(other_config));
+                CHECK(other_realm.objects<AllTypesObject>().size() == 1);
+            }).join();
+            realm.close();
+        }
+
+        auto realm = db(config);
+        CHECK(realm.objects<AllTypesObject>().size() == 0);
+    }
+
+    TEST_CASE("frozen versions") {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        config.set_max_number_of_active_versions(4);
+        CHECK(config.max_number_of_active_versions() == 4);
+        auto realm = db(config);
+        auto add_object = [&realm](int64_t id) {
+            realm.write([&realm, id] {
+                AllTypesObject obj;
+                obj._id = id;
+                realm.add(std::move(obj));
+            });
+        };
+        add_object(0);
+
+        auto frozen_for_path = [&path] {
+            std::vector<frozen_version> versions;
+            for (auto& version : get_frozen_versions()) {
+                if (version.path == path.path) {
+                    versions.push_back(version);
+                }
+            }
+            return versions;
+        };
+        CHECK(frozen_for_path().empty());
+
+        std::vector<db> frozen;
+        frozen.push_back(realm.freeze());
+        auto frozen_results = realm.objects<AllTypesObject>().freeze();
+        auto versions = frozen_for_path();
+        REQUIRE(versions.size() == 1);
+        CHECK(versions[0].version == realm.m_realm.read_transaction_version());
+        CHECK(versions[0].handles >= 2);
+        CHECK(versions[0].age >= std::chrono::steady_clock::duration::zero());
+
+        // Holding on to every version eventually exceeds the limit instead of growing the file.
+        CHECK_THROWS([&] {
+            for (int64_t i = 1; i < 10; i++) {
+                add_object(i);
+                frozen.push_back(realm.freeze());
+            }
+        }());
+        CHECK(frozen_for_path().size() <= 4);
+    }
+
+    TEST_CASE("write copy") {
+        realm_path path;
+        realm_path copy_path;
+        realm_path encrypted_copy_path;
+        realm::db_config config;
+        config.set_path(path);
+        auto realm = db(std::move(config));
+        realm.write([&realm] {
+            for (int64_t i = 0; i < 100; ++i) {
+                AllTypesObject o;
+                o._id = i;
+                realm.add(std::move(o));
+            }
+        });
+
+        auto version = realm.write_copy(copy_path);
+        REQUIRE(version);
+        {
+            realm::db_config copy_config;
+            copy_config.set_path(copy_path);
+            auto copy = db(std::move(copy_config));
+            CHECK(copy.objects<AllTypesObject>().size() == 100);
+        }
+
+        // Nothing changed since the last copy.
+        CHECK_FALSE(realm.write_copy(encrypted_copy_path, {std::nullopt, version}));
+        CHECK_FALSE(std::filesystem::exists(encrypted_copy_path.path));
+
+        realm.write([&realm] {
+            AllTypesObject o;
+            o._id = 100;
+            realm.add(std::move(o));
+        });
+        std::array<char, 64> key = {1, 2, 3};
+        auto encrypted_version = realm.write_copy(encrypted_copy_path, {key, version});
+        REQUIRE(encrypted_version);
+        CHECK(*encrypted_version > *version);
+        {
+            realm::db_config copy_config;
+            copy_config.set_path(encrypted_copy_path);
+            REQUIRE_THROWS(db(copy_config));
+            copy_config.set_encryption_key(key);
+            auto copy = db(std::move(copy_config));
+            CHECK(copy.objects<AllTypesObject>().size() == 101);
+        }
+    }
+
+    TEST_CASE("write transactions") {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        auto realm = db(std::move(config));
+        auto add_object = [&realm](int64_t id) {
+            AllTypesObject o;
+            o._id = id;
+            realm.add(std::move(o));
+        };
+
+        SECTION("write cancels when an exception is thrown") {
+            CHECK_THROWS_WITH(realm.write([&] {
+                add_object(1);
+                throw std::runtime_error("failed");
+            }), "failed");
+            CHECK_FALSE(realm.is_in_write());
+            CHECK(realm.objects<AllTypesObject>().size() == 0);
+            realm.write([&] {
+                add_object(2);
+            });
+            CHECK(realm.objects<AllTypesObject>().size() == 1);
+        }
+
+        SECTION("cancel_write") {
+            realm.begin_write();
+            add_object(1);
+            CHECK(realm.is_in_write());
+            realm.cancel_write();
+            CHECK_FALSE(realm.is_in_write());
+            CHECK(realm.objects<AllTypesObject>().size() == 0);
+        }
+
+        SECTION("write_transaction") {
+            {
+                write_transaction transaction(realm);
+                add_object(1);
+            }
+            CHECK_FALSE(realm.is_in_write());
+            CHECK(realm.objects<AllTypesObject>().size() == 0);
+            {
+                write_transaction transaction(realm);
+                add_object(1);
+                transaction.commit();
+            }
+            CHECK(realm.objects<AllTypesObject>().size() == 1);
+        }
+
+        SECTION("write_chunked") {
+            std::vector<int64_t> ids(25);
+            std::iota(ids.begin(), ids.end(), 0);
+            size_t commits = realm.write_chunked(ids, [&](int64_t id) {
+                add_object(id);
+            }, 10);
+            CHECK(commits == 3);
+            CHECK(realm.objects<AllTypesObject>().size() == 25);
+
+            // Chunks committed before the failure are kept.
+            std::iota(ids.begin(), ids.end(), 100);
+            CHECK_THROWS(realm.write_chunked(ids, [&](int64_t id) {
+                if (id == 115) {
+                    throw std::runtime_error("failed");
+                }
+                add_object(id);
+            }, 10));
+            CHECK_FALSE(realm.is_in_write());
+            CHECK(realm.objects<AllTypesObject>().size() == 35);
+        }
+    }
+
+    TEST_CASE("compaction") {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        auto realm = db(std::move(config));
+        realm.write([&realm] {
+            for (int64_t i = 0; i < 1000; ++i) {
+                AllTypesObject o;
+                o._id = i;
+                o.str_col = std::string(256, 'a');
+                realm.add(std::move(o));
+            }
+        });
+        CHECK(realm.file_stats().objects_per_type["AllTypesObject"] == 1000);
+
+        realm.write([&realm] {
+            auto objects = realm.objects<AllTypesObject>();
+            while (objects.size() > 0) {
+                auto o = objects[0];
+                realm.remove(o);
+            }
+        });
+        auto before = realm.file_stats();
+        CHECK(before.objects_per_type["AllTypesObject"] == 0);
+        CHECK(before.free_bytes > 0);
+        CHECK(before.total_bytes == before.used_bytes + before.free_bytes);
+
+        // The file is never more than completely free.
+        CHECK_FALSE(realm.compact_if_needed({1.1, 0}));
+        CHECK_FALSE(realm.compact_if_needed({0, before.total_bytes + 1}));
+
+        SECTION("compact_if_needed") {
+            REQUIRE(realm.compact_if_needed({0.1, 0}));
+            CHECK(realm.file_stats().total_bytes < before.total_bytes);
+        }
+
+        SECTION("compact") {
+            realm.write([&realm] {
+                CHECK_FALSE(realm.compact());
+            });
+            REQUIRE(realm.compact());
+            CHECK(realm.file_stats().total_bytes < before.total_bytes);
+        }
+        CHECK(realm.objects<AllTypesObject>().size() == 0);
+    }
+
     TEST_CASE("encrypted realm") {
         std::array<char, 64> example_key = {0,0,0,0,0,0,0,0, 1,1,0,0,0,0,0,0, 2,2,0,0,0,0,0,0, 3,3,0,0,0,0,0,0, 4,4,0,0,0,0,0,0, 5,5,0,0,0,0,0,0, 6,6,0,0,0,0,0,0, 7,7,0,0,0,0,0,0};
         realm_path path;
@@ -1,6 +1,8 @@
 #include "../main.hpp"
 #include "test_objects.hpp"
 
+#include <atomic>
+
 namespace realm {
     struct results_wrapper {
         explicit results_wrapper(const db_config &c) {
@@ -189,6 +191,88 @@ namespace realm {
             CHECK(did_run);
         }
 
+        SECTION("results_notifications_coalesced") {
+            auto realm = db(std::move(config));
+            int callback_count = 0;
+            results<AllTypesObject>::results_change change;
+            auto results = realm.objects<AllTypesObject>();
+            observe_options options;
+            options.max_batch = 2;
+            auto token = results.observe([&](auto&& c) {
+                callback_count++;
+                change = std::move(c);
+            }, options);
+            realm.refresh();
+            CHECK(callback_count == 1);
+
+            realm.write([&realm] {
+                AllTypesObject o;
+                o._id = 1;
+                realm.add(std::move(o));
+            });
+            realm.refresh();
+            CHECK(callback_count == 1);
+
+            realm.write([&realm] {
+                AllTypesObject o;
+                o._id = 2;
+                realm.add(std::move(o));
+            });
+            realm.refresh();
+            CHECK(callback_count == 2);
+            CHECK(change.insertions.size() == 2);
+            CHECK(change.deletions.empty());
+        }
+
+        SECTION("results_notifications_filtered") {
+            auto realm = db(std::move(config));
+            int callback_count = 0;
+            results<AllTypesObject>::results_change change;
+            auto results = realm.objects<AllTypesObject>().where([](auto& o) {
+                return o.str_col == "John";
+            });
+            observe_options options;
+            options.key_paths = {"str_col"};
+            auto token = results.observe([&](auto&& c) {
+                callback_count++;
+                change = std::move(c);
+            }, options);
+            realm.refresh();
+            CHECK(callback_count == 1);
+
+            auto jane = realm.write([&realm] {
+                AllTypesObject o;
+                o._id = 1;
+                o.str_col = "Jane";
+                return realm.add(std::move(o));
+            });
+            realm.refresh();
+            CHECK(callback_count == 1);
+
+            auto john = realm.write([&realm] {
+                AllTypesObject o;
+                o._id = 2;
+                o.str_col = "John";
+                return realm.add(std::move(o));
+            });
+            realm.refresh();
+            CHECK(callback_count == 2);
+            CHECK(change.insertions.size() == 1);
+
+            realm.write([&john] {
+                john.double_col = 42.0;
+            });
+            realm.refresh();
+            CHECK(callback_count == 2);
+
+            realm.write([&jane] {
+                jane.str_col = "John";
+            });
+            realm.refresh();
+            CHECK(callback_count == 3);
+            CHECK(change.insertions.size() == 1);
+        }
+
         managed<AllTypesObject> test_obj;
 
         SECTION("results_subscript") {
@@ -373,6 +457,150 @@ namespace realm {
             CHECK(sorted_results_with_descriptors_descending[1].str_col == "bar");
         }
 
+        SECTION("results_evaluate_async") {
+            auto realm = db(std::move(config));
+            realm.write([&realm]() {
+                for (int64_t i = 0; i < 100; i++) {
+                    AllTypesObjectLink o;
+                    o._id = i;
+                    realm.add(std::move(o));
+                }
+            });
+            auto results = realm.objects<AllTypesObjectLink>().where([](auto& o) {
+                return o._id < 10;
+            }).sort("_id", false);
+
+            int invocations = 0;
+            std::optional<realm::results<AllTypesObjectLink>> evaluated;
+            auto token = results.evaluate_async([&](auto&& r) {
+                invocations++;
+                evaluated.emplace(std::move(r));
+            });
+            CHECK(invocations == 0);
+
+            // Releasing the token cancels an evaluation which hasn't been delivered yet.
+            int cancelled_invocations = 0;
+            {
+                auto cancelled = results.evaluate_async([&](auto&&) {
+                    cancelled_invocations++;
+                });
+            }
+
+            realm.write([&realm]() {
+                AllTypesObjectLink o;
+                o._id = 100;
+                realm.add(std::move(o));
+            });
+            realm.refresh();
+            REQUIRE(invocations == 1);
+            CHECK(cancelled_invocations == 0);
+            CHECK(evaluated->size() == 10);
+            CHECK((*evaluated)[0]._id == 9);
+            CHECK((*evaluated)[9]._id == 0);
+
+            // The callback is only invoked for the first evaluation.
+            realm.write([&realm]() {
+                AllTypesObjectLink o;
+                o._id = -1;
+                realm.add(std::move(o));
+            });
+            realm.refresh();
+            CHECK(invocations == 1);
+        }
+
+        SECTION("results_snapshot") {
+            auto realm = db(std::move(config));
+            realm.write([&realm]() {
+                for (int64_t i = 0; i < 10; i++) {
+                    AllTypesObjectLink o;
+                    o._id = i;
+                    o.str_col = "pending";
+                    realm.add(std::move(o));
+                }
+            });
+            auto pending = realm.objects<AllTypesObjectLink>().where([](auto& o) {
+                return o.str_col == "pending";
+            });
+            auto snapshot = pending.snapshot();
+            CHECK(snapshot.size() == 10);
+
+            realm.write([&]() {
+                for (size_t i = 0; i < snapshot.size(); i++) {
+                    snapshot[i].str_col = "done";
+                }
+            });
+            CHECK(pending.size() == 0);
+            CHECK(snapshot.size() == 10);
+            CHECK(snapshot[9].str_col == "done");
+
+            realm.write([&]() {
+                for (auto o : snapshot) {
+                    realm.remove(o);
+                }
+            });
+            CHECK(realm.objects<AllTypesObjectLink>().size() == 0);
+        }
+
+        SECTION("results_parallel") {
+            auto realm = db(std::move(config));
+            realm.write([&realm]() {
+                for (int64_t i = 0; i < 10000; i++) {
+                    AllTypesObjectLink o;
+                    o._id = i;
+                    realm.add(std::move(o));
+                }
+            });
+            auto upper = realm.objects<AllTypesObjectLink>().where([](auto& o) {
+                return o._id >= 5000;
+            });
+
+            // Catch assertions are not thread safe, so only count from the workers.
+            std::atomic<int64_t> visited = 0;
+            std::atomic<int64_t> out_of_range = 0;
+            upper.parallel_for_each([&](auto&& o) {
+                if (static_cast<int64_t>(o._id) < 5000) {
+                    out_of_range++;
+                }
+                visited++;
+            }, 4);
+            CHECK(visited == 5000);
+            CHECK(out_of_range == 0);
+
+            auto sum = [&](size_t concurrency) {
+                return upper.parallel_reduce(int64_t(0), [](auto&& o) {
+                    return static_cast<int64_t>(o._id);
+                }, [](int64_t a, int64_t b) { return a + b; }, concurrency);
+            };
+            CHECK(sum(1) == 37497500);
+            CHECK(sum(4) == 37497500);
+
+            auto ids = [&](size_t concurrency) {
+                return upper.sort("_id", false).parallel_reduce(std::vector<int64_t>(), [](auto&& o) {
+                    return std::vector<int64_t>{static_cast<int64_t>(o._id)};
+                }, [](std::vector<int64_t> a, std::vector<int64_t> b) {
+                    a.insert(a.end(), b.begin(), b.end());
+                    return a;
+                }, concurrency);
+            };
+            auto sorted_ids = ids(8);
+            CHECK(sorted_ids == ids(1));
+            CHECK(sorted_ids.size() == 5000);
+            CHECK(sorted_ids.front() == 9999);
+            CHECK(sorted_ids.back() == 5000);
+
+            // Every call scans the version which is current when it starts.
+            realm.write([&realm]() {
+                AllTypesObjectLink o;
+                o._id = 10000;
+                realm.add(std::move(o));
+            });
+            CHECK(sum(2) == 37497500 + 10000);
+
+            CHECK_THROWS(upper.parallel_for_each([](auto&&) {
+                throw std::runtime_error("stop");
+            }));
+        }
+
         SECTION("observe_results_derived_from_list") {
             auto realm = db(std::move(config));
 
@@ -649,6 +649,91 @@ TEST_CASE("set", "[set]") {
         CHECK(res == std::set<int64_t>({1, 2}));
     }
 
+    SECTION("set algebra") {
+        auto realm = realm::db(std::move(config));
+        auto obj = realm::AllTypesObject();
+        obj._id = 1;
+        auto obj2 = realm::AllTypesObject();
+        obj2._id = 2;
+        auto managed_obj = realm.write([&]() {
+            return realm.add(std::move(obj));
+        });
+        auto managed_obj2 = realm.write([&]() {
+            return realm.add(std::move(obj2));
+        });
+
+        realm.write([&]() {
+            for (auto v : {1, 2, 3}) {
+                managed_obj.set_int_col.insert(v);
+            }
+            for (auto v : {2, 3, 4}) {
+                managed_obj2.set_int_col.insert(v);
+            }
+        });
+        CHECK(managed_obj.set_int_col.intersects(managed_obj2.set_int_col));
+        CHECK_FALSE(managed_obj.set_int_col.is_subset_of(managed_obj2.set_int_col));
+
+        realm.write([&]() {
+            managed_obj.set_int_col.union_with(managed_obj2.set_int_col);
+        });
+        CHECK(managed_obj.set_int_col.detach() == std::set<int64_t>({1, 2, 3, 4}));
+        CHECK(managed_obj2.set_int_col.is_subset_of(managed_obj.set_int_col));
+
+        realm.write([&]() {
+            managed_obj.set_int_col.subtract(managed_obj2.set_int_col);
+        });
+        CHECK(managed_obj.set_int_col.detach() == std::set<int64_t>({1}));
+        CHECK_FALSE(managed_obj.set_int_col.intersects(managed_obj2.set_int_col));
+
+        realm.write([&]() {
+            managed_obj.set_int_col.insert(3);
+            managed_obj.set_int_col.intersect_with(managed_obj2.set_int_col);
+        });
+        CHECK(managed_obj.set_int_col.detach() == std::set<int64_t>({3}));
+        CHECK(managed_obj2.set_int_col.is_superset_of(managed_obj.set_int_col));
+        CHECK_FALSE(managed_obj.set_int_col.is_superset_of(managed_obj2.set_int_col));
+
+        realm.write([&]() {
+            managed_obj.set_int_col.symmetric_difference_with(managed_obj2.set_int_col);
+        });
+        CHECK(managed_obj.set_int_col.detach() == std::set<int64_t>({2, 4}));
+        CHECK_FALSE(managed_obj.set_int_col.set_equals(managed_obj2.set_int_col));
+        realm.write([&]() {
+            managed_obj.set_int_col.insert(3);
+        });
+        CHECK(managed_obj.set_int_col.set_equals(managed_obj2.set_int_col));
+
+        AllTypesObjectLink link;
+        link._id = 1;
+        AllTypesObjectLink link2;
+        link2._id = 2;
+        realm.write([&]() {
+            auto managed_link = realm.add(std::move(link));
+            auto managed_link2 = realm.add(std::move(link2));
+            managed_obj.set_obj_col.insert(managed_link);
+            managed_obj2.set_obj_col.insert(managed_link);
+            managed_obj2.set_obj_col.insert(managed_link2);
+        });
+        CHECK(managed_obj.set_obj_col.is_subset_of(managed_obj2.set_obj_col));
+        realm.write([&]() {
+            managed_obj2.set_obj_col.subtract(managed_obj.set_obj_col);
+        });
+        CHECK(managed_obj2.set_obj_col.size() == 1);
+        CHECK((*managed_obj2.set_obj_col.begin())._id == 2);
+        CHECK_FALSE(managed_obj.set_obj_col.intersects(managed_obj2.set_obj_col));
+        realm.write([&]() {
+            managed_obj.set_obj_col.union_with(managed_obj2.set_obj_col);
+        });
+        CHECK(managed_obj.set_obj_col.size() == 2);
+        CHECK(managed_obj.set_obj_col.is_superset_of(managed_obj2.set_obj_col));
+        CHECK_FALSE(managed_obj.set_obj_col.set_equals(managed_obj2.set_obj_col));
+        realm.write([&]() {
+            managed_obj.set_obj_col.symmetric_difference_with(managed_obj2.set_obj_col);
+        });
+        CHECK(managed_obj.set_obj_col.size() == 1);
+        CHECK((*managed_obj.set_obj_col.begin())._id == 1);
+    }
+
     SECTION("object lifetime") {
         std::unique_ptr<managed<AllTypesObjectLink>> ptr;
         {
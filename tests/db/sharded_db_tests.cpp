@@ -0,0 +1,88 @@
+#include "../main.hpp"
+#include "test_objects.hpp"
+
+namespace realm {
+    TEST_CASE("sharded_db") {
+        realm_path path;
+        realm::db_config config;
+        config.set_path(path);
+        // realm_path removes its files when it goes out of scope.
+        auto remove_shards = [&](size_t shard_count) {
+            std::vector<realm_path> shard_paths(shard_count);
+            for (size_t i = 0; i < shard_count; i++) {
+                shard_paths[i].path = path.path + ".shard-" + std::to_string(i);
+            }
+        };
+
+        SECTION("add and query") {
+            {
+                auto sharded = sharded_db<AllTypesObjectLink, StringObject>(config, 4);
+                CHECK(sharded.shard_count() == 4);
+
+                std::vector<AllTypesObjectLink> objects;
+                for (int64_t i = 0; i < 1000; i++) {
+                    AllTypesObjectLink o;
+                    o._id = i;
+                    o.str_col = "obj";
+                    objects.push_back(std::move(o));
+                }
+                sharded.add(std::move(objects));
+
+                CHECK(sharded.count<AllTypesObjectLink>() == 1000);
+                auto per_shard = sharded.objects<AllTypesObjectLink>();
+                CHECK(per_shard.size() == 4);
+                for (size_t i = 0; i < per_shard.size(); i++) {
+                    CHECK(per_shard[i].size() > 0);
+                    for (auto o : per_shard[i]) {
+                        CHECK(sharded.shard_for(o.detach()) == i);
+                    }
+                }
+                CHECK(std::get<int64_t>(*sharded.min<AllTypesObjectLink>("_id")) == 0);
+                CHECK(std::get<int64_t>(*sharded.max<AllTypesObjectLink>("_id")) == 999);
+                CHECK(std::get<int64_t>(*sharded.sum<AllTypesObjectLink>("_id")) == 499500);
+
+                AllTypesObjectLink single;
+                single._id = 1000;
+                sharded.add(std::move(single));
+                CHECK(sharded.count<AllTypesObjectLink>() == 1001);
+            }
+            remove_shards(4);
+        }
+
+        SECTION("custom shard key and shard writes") {
+            {
+                auto sharded = sharded_db<AllTypesObjectLink, StringObject>(config, 2);
+                sharded.set_shard_key<AllTypesObjectLink>([](const AllTypesObjectLink& o) {
+                    return o.str_col == "left" ? 0 : 1;
+                });
+                AllTypesObjectLink left;
+                left._id = 1;
+                left.str_col = "left";
+                AllTypesObjectLink right;
+                right._id = 2;
+                right.str_col = "right";
+                sharded.add(std::move(left));
+                sharded.add(std::move(right));
+                CHECK(sharded.shard(0).objects<AllTypesObjectLink>()[0].str_col == "left");
+                CHECK(sharded.shard(1).objects<AllTypesObjectLink>()[0].str_col == "right");
+
+                sharded.write(1, [](db& shard) {
+                    shard.objects<AllTypesObjectLink>()[0].str_col = "updated";
+                }).get();
+                CHECK(sharded.shard(1).objects<AllTypesObjectLink>()[0].str_col == "updated");
+
+                // A failed write is rolled back and doesn't block later writes.
+                CHECK_THROWS(sharded.write(0, [](db&) {
+                    throw std::runtime_error("stop");
+                }).get());
+                AllTypesObjectLink another;
+                another._id = 3;
+                another.str_col = "left";
+                sharded.add(std::move(another));
+                CHECK(sharded.count<AllTypesObjectLink>() == 3);
+                CHECK(sharded.shard(0).objects<AllTypesObjectLink>().size() == 2);
+            }
+            remove_shards(2);
+        }
+    }
+}